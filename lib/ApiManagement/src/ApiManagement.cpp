@@ -2,34 +2,42 @@
 
 ApiManagement::ApiManagement(DatetimeInterval &datetime) : datetime(datetime) { }
 
-void ApiManagement::begin(const String &address, uint16_t port, uint8_t maxAttempts, uint8_t minutesUpdateMeasures) {
+void ApiManagement::begin(const String &address, uint16_t port, uint16_t timeout, uint8_t minutesUpdateMeasures) {
     Serial.println("\033[1;92m-------------------- [DATABASE] -------------------\033[0m");
     this->datetime.begin(minutesUpdateMeasures > 240 ? 240 : minutesUpdateMeasures);
-    this->jsonArrayMeasures = jsonDocumentMeasures.to<JsonArray>();
+    setServer(address, port, timeout);
+    this->isRoomManaged = true;
 
+    updateRoom();
+}
+
+void ApiManagement::setServer(const String &address, uint16_t port, uint16_t timeout) {
     this->serverAddress = address;
     this->serverPort = port;
 
-    this->maxAttempts = maxAttempts;
+    /* The client bounds the resolution of the address and the connection, the HTTP client the response. */
+    wifiClient.setTimeout(timeout);
+    httpClient.setTimeout(timeout);
 
     this->updateState = true;
-
-    while (!updateRoom()) { delay(1000); };
 }
 
 void ApiManagement::setCredentials(const String &serverUsername, const String &serverPassword) {
     this->serverUsername = serverUsername;
     this->serverPassword = serverPassword;
+    this->isLoggedIn = false;
 }
 
 void ApiManagement::setRoomNumber(uint8_t roomNumber) { this->roomNumber = roomNumber; }
 
 uint8_t ApiManagement::getRoomNumber() const { return roomNumber; }
 
+void ApiManagement::setSensor(const Sensor *sensor) { this->sensor = sensor; }
+
 bool ApiManagement::isUpdated() { return updateState; }
 
 bool ApiManagement::updateRoom() {
-    if (WiFi.status() == WL_CONNECTED) {
+    if (isLinkUp) {
         if (login() == 200) {
             if (requestRoomChangeStateActivation() == 200 && requestRoomChangeLocalIp(WiFi.localIP().toString()) == 200) {
                 updateState = true;
@@ -47,140 +55,232 @@ bool ApiManagement::updateRoom() {
 }
 
 int ApiManagement::login() {
-    uint8_t countAttempts = 1;
-
     /* Login into the server and taking the token. */
-    do {
-        yield();
+    const int resultStatusCode = requestLogin();
+    if (resultStatusCode == 200) {
+        /* Storing the token for next purposes. */
+        jsonDocumentLogin["token"]["tokenType"] = true;
+        deserializeJson(jsonDocumentLogin, httpJsonResponse);
+        serverToken = static_cast<String>(jsonDocumentLogin["token"]);
+        serverTokenType = static_cast<String>(jsonDocumentLogin["tokenType"]);
+        isLoggedIn = true;
+
+        return resultStatusCode;
+    }
 
-        const uint16_t resultStatusCode = requestLogin();
-        if (resultStatusCode == 200) {
-            /* Storing the token for next purposes. */
-            jsonDocumentLogin["token"]["tokenType"] = true;
-            deserializeJson(jsonDocumentLogin, httpJsonResponse);
-            serverToken = static_cast<String>(jsonDocumentLogin["token"]);
-            serverTokenType = static_cast<String>(jsonDocumentLogin["tokenType"]);
+    isLoggedIn = false;
+    return 0;
+}
+
+size_t ApiManagement::getMeasuresQueued() const { return measuresCount; }
+
+bool ApiManagement::isUploadDue() const { return isUploadPending && isLinkUp; }
 
-            return resultStatusCode;
+void ApiManagement::queueMeasures(uint32_t epoch, double temperature, double humidity) {
+    /* The ring drops the oldest measure when full, without moving the others. */
+    if (measuresCount == API_MANAGEMENT_MAX_MEASURES) {
+        measuresFirst = (measuresFirst + 1) % API_MANAGEMENT_MAX_MEASURES;
+        measuresCount--;
+    }
+
+    ApiManagementMeasure &measure = measures[(measuresFirst + measuresCount) % API_MANAGEMENT_MAX_MEASURES];
+    measure.epoch = epoch;
+    measure.temperature = static_cast<int16_t>(lround(temperature * 100));
+    measure.humidity = static_cast<uint16_t>(lround(constrain(humidity, 0.0, 100.0) * 100));
+    measure.hasSensor = (sensor != nullptr);
+    measuresCount++;
+
+    /* Taking the health counters of the sensor, summarized over all devices. */
+    if (measure.hasSensor) {
+        uint32_t failures = 0;
+        uint32_t rejections = 0;
+        uint32_t latencyMax = 0;
+        uint16_t samplesPerMinute = UINT16_MAX;
+        bool isStuck = false;
+        const unsigned long now = millis();
+
+        for (uint8_t i = 0; i < sensor->getDevicesCount(); i++) {
+            const SensorTelemetry &telemetry = sensor->getTelemetry(i);
+
+            failures += telemetry.getFailures();
+            rejections += telemetry.getRejections();
+            latencyMax = max(latencyMax, telemetry.getLatencyMax());
+            samplesPerMinute = min(samplesPerMinute, telemetry.getSamplesPerMinute(now));
+            isStuck = isStuck || telemetry.isStuck();
         }
-    } while (countAttempts++ < maxAttempts);
 
-    return 0;
+        measure.sensorFailures = failures;
+        measure.sensorRejections = rejections;
+        measure.sensorLatencyMax = latencyMax;
+        measure.sensorSamplesMinute = (samplesPerMinute == UINT16_MAX) ? 0 : samplesPerMinute;
+        measure.isSensorStuck = isStuck;
+    }
 }
 
-bool ApiManagement::addMeasures(const String &timestamp, double temperature, double humidity) {
-    /* Creating the JSON body. */
-    if (jsonArrayMeasures.size() == 5) {
-        jsonArrayMeasures.remove(0);
-    }
+bool ApiManagement::upload() {
+    datetime.syncDatetime();
 
-    const JsonObject measures = jsonArrayMeasures.createNestedObject();
-    measures["when"] = timestamp;
-    measures["room_number"] = roomNumber;
-    measures["temperature"] = String(temperature, 2);
-    measures["humidity"] = String(humidity, 2);
+    return sendMeasures();
+}
 
-    String jsonDocumentMeasuresSerialized;
-    serializeJson(jsonArrayMeasures, jsonDocumentMeasuresSerialized);
+bool ApiManagement::sendMeasures() {
+    isUploadPending = false;
 
-    /*
-     * Check the connection and adding measures if there is connection and the login has been successful,
-     *  or reconnecting in case of error.
-     */
-    if (WiFi.status() == WL_CONNECTED) {
-        if (login() == 200) {
-            if (updateState) {
-                requestRoomChangeLocalIp(WiFi.localIP().toString());
-            }
+    if (!isLinkUp) {
+        Serial.println("\033[1;91m[WIFI ERROR FROM ApiManagement]\033[0m");
 
-            requestMeasuresSet(jsonDocumentMeasuresSerialized);
+        updateState = false;
+        return updateState;
+    }
 
-            Serial.println("\033[1;92m---------------- [TRANSACTION JSON] ---------------\033[0m");
-            for (auto && jsonArrayMeasure : jsonArrayMeasures) {
-                yield();
+    /* The token of the last login is used again, so a sequence of uploads logs in once. */
+    if (!isLoggedIn && login() != 200) {
+        updateState = false;
+        return updateState;
+    }
 
-                JsonObject measure = jsonArrayMeasure.as<JsonObject>();
-                Serial.println("\033[1;92mVALUES AT " + static_cast<String>(measure["when"]) + "\033[0m");
-                Serial.println("\t\033[1;97mTEMPERATURE:   " + String(measure["temperature"]) + "\033[0m");
-                Serial.println("\t\033[1;97mHUMIDITY:      " + String(measure["humidity"]) + "\033[0m");
-            }
-            Serial.println("\033[1;92m---------------------------------------------------\033[0m\n");
+    String jsonDocumentMeasuresSerialized;
+    if (!serializeMeasures(jsonDocumentMeasuresSerialized)) {
+        updateState = false;
+        return updateState;
+    }
 
-            jsonArrayMeasures.clear();
-            jsonDocumentMeasures.garbageCollect();
+    /* Only the device that serves the socket keeps its local IP updated; the one in batch mode is asleep. */
+    if (isRoomManaged && updateState) {
+        requestRoomChangeLocalIp(WiFi.localIP().toString());
+    }
 
-            updateState = true;
-        } else {
-            updateState = false;
+    int resultStatusCode = requestMeasuresSet(jsonDocumentMeasuresSerialized);
+    if (resultStatusCode == 401) {
+        /* The token has expired, so logging in again with a single retry of the upload. */
+        isLoggedIn = false;
+        if (login() == 200) {
+            resultStatusCode = requestMeasuresSet(jsonDocumentMeasuresSerialized);
         }
+    }
+
+    /* The measures are kept queued unless the server has accepted them. */
+    if (resultStatusCode < 200 || resultStatusCode > 299) {
+        Serial.println("\033[1;91m[MEASURES ERROR: " + String(resultStatusCode) + ", " + String(measuresCount) + " MEASURES KEPT]\033[0m");
 
+        updateState = false;
         return updateState;
     }
 
-    if (WiFi.status() == WL_DISCONNECTED) {
-        Serial.println("\033[1;91m[WIFI ERROR FROM ApiManagement]\033[0m");
+    Serial.println("\033[1;92m---------------- [TRANSACTION JSON] ---------------\033[0m");
+    for (uint8_t i = 0; i < measuresCount; i++) {
+        yield();
+
+        const ApiManagementMeasure &measure = getMeasure(i);
+        Serial.println("\033[1;92mVALUES AT " + datetime.getTimestamp(measure.epoch) + "\033[0m");
+        Serial.println("\t\033[1;97mTEMPERATURE:   " + String(measure.temperature / 100.0, 2) + "\033[0m");
+        Serial.println("\t\033[1;97mHUMIDITY:      " + String(measure.humidity / 100.0, 2) + "\033[0m");
     }
+    Serial.println("\033[1;92m---------------------------------------------------\033[0m\n");
+
+    measuresFirst = 0;
+    measuresCount = 0;
 
-    updateState = false;
+    updateState = true;
     return updateState;
 }
 
+void ApiManagement::updateLink(bool isConnected) { isLinkUp = isConnected; }
+
 void ApiManagement::update(double temperature, double humidity) {
     if (datetime.checkDatetime()) {
         Serial.println("\033[1;92m-------------------- [DATABASE] -------------------\033[0m");
 
-        addMeasures(datetime.getActualTimestamp(), temperature, humidity);
+        queueMeasures(datetime.getActualEpoch(), temperature, humidity);
+        isUploadPending = true;
         datetime.configNextDatetime();
 
         Serial.println("\033[1;96m[FREE HEAP SIZE: " + String(ESP.getFreeHeap()) + "]\033[0m");
     }
 }
 
+const ApiManagementMeasure &ApiManagement::getMeasure(uint8_t index) const { return measures[(measuresFirst + index) % API_MANAGEMENT_MAX_MEASURES]; }
+
+bool ApiManagement::serializeMeasures(String &jsonDocumentMeasuresSerialized) {
+    /* The document is freed on return, so between two uploads the queue costs only its records. */
+    DynamicJsonDocument jsonDocumentMeasures(API_MANAGEMENT_MEASURES_CAPACITY);
+    if (jsonDocumentMeasures.capacity() == 0) {
+        Serial.println(F("\033[1;91m[MEASURES ERROR: NO MEMORY FOR THE JSON DOCUMENT]\033[0m"));
+        return false;
+    }
+
+    const JsonArray jsonArrayMeasures = jsonDocumentMeasures.to<JsonArray>();
+    for (uint8_t i = 0; i < measuresCount; i++) {
+        const ApiManagementMeasure &measure = getMeasure(i);
+
+        const JsonObject jsonObjectMeasure = jsonArrayMeasures.createNestedObject();
+        jsonObjectMeasure["when"] = datetime.getTimestamp(measure.epoch);
+        jsonObjectMeasure["room_number"] = roomNumber;
+        jsonObjectMeasure["temperature"] = String(measure.temperature / 100.0, 2);
+        jsonObjectMeasure["humidity"] = String(measure.humidity / 100.0, 2);
+
+        if (measure.hasSensor) {
+            jsonObjectMeasure["sensor_failures"] = measure.sensorFailures;
+            jsonObjectMeasure["sensor_rejections"] = measure.sensorRejections;
+            jsonObjectMeasure["sensor_latency_max"] = measure.sensorLatencyMax;
+            jsonObjectMeasure["sensor_samples_minute"] = measure.sensorSamplesMinute;
+            jsonObjectMeasure["sensor_stuck"] = measure.isSensorStuck;
+        }
+    }
+
+    if (jsonDocumentMeasures.overflowed()) {
+        Serial.println(F("\033[1;91m[MEASURES ERROR: JSON DOCUMENT FULL, MEASURE TRUNCATED]\033[0m"));
+    }
+
+    serializeJson(jsonDocumentMeasures, jsonDocumentMeasuresSerialized);
+    return true;
+}
+
 int ApiManagement::requestLogin() {
-    httpClient.begin(wifiClient, serverAddress + ":" + serverPort + "/" + API_MANAGEMENT_URI_USER_LOGIN);
+    httpClient.begin(wifiClient, serverAddress + ":" + serverPort + "/" + FPSTR(API_MANAGEMENT_URI_USER_LOGIN));
     httpClient.addHeader("Content-Type", "application/x-www-form-urlencoded");
     const int responseCode = httpClient.POST("username=" + serverUsername + "&password=" + serverPassword);
     httpJsonResponse = httpClient.getString();
     httpClient.end();
 
-    Serial.println("\033[1;96m[RESPONSE FOR " + API_MANAGEMENT_URI_USER_LOGIN + ": " + String(responseCode) + "]\033[0m\n");
+    Serial.println("\033[1;96m[RESPONSE FOR " + String(FPSTR(API_MANAGEMENT_URI_USER_LOGIN)) + ": " + String(responseCode) + "]\033[0m\n");
 
     return responseCode;
 }
 
 int ApiManagement::requestRoomChangeStateActivation() {
-    httpClient.begin(wifiClient, serverAddress + ":" + serverPort + "/" + API_MANAGEMENT_URI_ROOM_CHANGE_STATE_ACTIVATION);
+    httpClient.begin(wifiClient, serverAddress + ":" + serverPort + "/" + FPSTR(API_MANAGEMENT_URI_ROOM_CHANGE_STATE_ACTIVATION));
     httpClient.addHeader("Authorization", serverTokenType + " " + serverToken);
     httpClient.addHeader("Content-Type", "application/x-www-form-urlencoded");
     const int responseCode = httpClient.PATCH("number=" + String(roomNumber) + "&is_active=1");
     httpClient.end();
 
-    Serial.println("\033[1;96m[RESPONSE FOR " + API_MANAGEMENT_URI_ROOM_CHANGE_STATE_ACTIVATION + ": " + String(responseCode) + "]\033[0m\n");
+    Serial.println("\033[1;96m[RESPONSE FOR " + String(FPSTR(API_MANAGEMENT_URI_ROOM_CHANGE_STATE_ACTIVATION)) + ": " + String(responseCode) + "]\033[0m\n");
 
     return responseCode;
 }
 
 int ApiManagement::requestRoomChangeLocalIp(const String &localIP) {
-    httpClient.begin(wifiClient, serverAddress + ":" + serverPort + "/" + API_MANAGEMENT_URI_ROOM_API_CHANGE_LOCAL_IP);
+    httpClient.begin(wifiClient, serverAddress + ":" + serverPort + "/" + FPSTR(API_MANAGEMENT_URI_ROOM_API_CHANGE_LOCAL_IP));
     httpClient.addHeader("Authorization", serverTokenType + " " + serverToken);
     httpClient.addHeader("Content-Type", "application/x-www-form-urlencoded");
     const int responseCode = httpClient.PATCH("number=" + String(roomNumber) + "&local_ip=" + localIP);
     httpClient.end();
 
-    Serial.println("\033[1;96m[RESPONSE FOR " + API_MANAGEMENT_URI_ROOM_API_CHANGE_LOCAL_IP + ": " + String(responseCode) + "]\033[0m\n");
+    Serial.println("\033[1;96m[RESPONSE FOR " + String(FPSTR(API_MANAGEMENT_URI_ROOM_API_CHANGE_LOCAL_IP)) + ": " + String(responseCode) + "]\033[0m\n");
 
     return responseCode;
 }
 
 int ApiManagement::requestMeasuresSet(const String &jsonDocumentMeasuresSerialized) {
-    httpClient.begin(wifiClient, serverAddress + ":" + serverPort + "/" + API_MANAGEMENT_URI_MEASURE_SET);
+    httpClient.begin(wifiClient, serverAddress + ":" + serverPort + "/" + FPSTR(API_MANAGEMENT_URI_MEASURE_SET));
     httpClient.addHeader("Authorization", serverTokenType + " " + serverToken);
     httpClient.addHeader("Content-Type", "application/json");
     httpClient.addHeader("Accept", "application/json");
     const int responseCode = httpClient.POST(jsonDocumentMeasuresSerialized);
     httpClient.end();
 
-    Serial.println("\033[1;96m[RESPONSE FOR " + API_MANAGEMENT_URI_MEASURE_SET + ": " + String(responseCode) + "]\033[0m\n");
+    Serial.println("\033[1;96m[RESPONSE FOR " + String(FPSTR(API_MANAGEMENT_URI_MEASURE_SET)) + ": " + String(responseCode) + "]\033[0m\n");
 
     return responseCode;
 }
\ No newline at end of file
@@ -11,8 +11,8 @@
  * @author Davide Palladino
  * @contact davidepalladino@hotmail.com
  * @website https://davidepalladino.github.io/
- * @version 6.0.0
- * @date 29th January 2025
+ * @version 6.9.0
+ * @date 18th October 2026
  */
 
 #ifndef APIMANAGEMENT_H
@@ -25,11 +25,27 @@
     #include <ArduinoJson.h>
     #include <DatetimeInterval.h>
     #include <Sensor.h>
+    #include <WiFiConnectionObserver.h>
 
     #include <ApiManagementConsts.h>
 
     class Sensor;
 
+    /**
+     * @brief A measure queued for the next upload, in a compact form: the JSON is built only by `sendMeasures()`.
+     */
+    struct ApiManagementMeasure {
+        uint32_t epoch;                                             /**< Datetime of the measure, as Unix time. */
+        int16_t temperature;                                        /**< Temperature, in hundredths of degree. */
+        uint16_t humidity;                                          /**< Humidity, in hundredths of percentage. */
+        uint32_t sensorFailures;                                    /**< Failures of all devices of the sensor. */
+        uint32_t sensorRejections;                                  /**< Values out of range of all devices of the sensor. */
+        uint32_t sensorLatencyMax;                                  /**< Longest read of the devices of the sensor, in microseconds. */
+        uint16_t sensorSamplesMinute;                               /**< Fewest reads per minute of the devices of the sensor. */
+        bool isSensorStuck;                                         /**< Indicates whether a device of the sensor is stuck. */
+        bool hasSensor;                                             /**< Indicates whether the health counters have been taken. */
+    };
+
     /**
      * @class ApiManagement
      * @brief Manages API interactions for the Air Analyzer system.
@@ -37,7 +53,7 @@
      * This class connects to a REST API server, performing operations such as user login,
      * updating room status, and sending measurement data.
      */
-    class ApiManagement : public SensorObserver {
+    class ApiManagement : public SensorObserver, public WiFiConnectionObserver {
         public:
             /**
             * @brief Constructs an ApiManagement object and sets the subject class.
@@ -49,11 +65,23 @@
              * @brief Initializes the API management system with update intervals.
              * @param address Server address (e.g., "192.168.1.100" or "domain.com").
              * @param port Server port number.
-             * @param maxAttempts Number of retry attempts if requests fail (default 0).
+             * @param timeout Longest wait of every request, resolution of the address included, in milliseconds (default 2000).
              * @param minutesUpdateMeasures Interval for updating measures (default 10 minutes).
              * @warning Call `setCredentials()` first to store the room ID in the API.
+             * @note It does not wait for the network: the room is updated with a single attempt, whose result is given
+             *  by `isUpdated()`, and the measures are queued with the datetime of the RTC until they can be sent.
              */
-            void begin(const String &address, uint16_t port, uint8_t maxAttempts = 0, uint8_t minutesUpdateMeasures = 10);
+            void begin(const String &address, uint16_t port, uint16_t timeout = 2000, uint8_t minutesUpdateMeasures = 10);
+
+            /**
+             * @brief Sets the server, without updating the room nor synchronizing the datetime.
+             * @param address Server address (e.g., "192.168.1.100" or "domain.com").
+             * @param port Server port number.
+             * @param timeout Longest wait of every request, resolution of the address included, in milliseconds (default 2000).
+             * @note Use it instead of `begin()` to only upload measures taken elsewhere, with `queueMeasures()` and `sendMeasures()`:
+             *  the local IP of the room is not updated, since the device does not serve the socket.
+             */
+            void setServer(const String &address, uint16_t port, uint16_t timeout = 2000);
 
             /**
              * @brief Sets user credentials for API authentication.
@@ -74,6 +102,12 @@
              */
             uint8_t getRoomNumber() const;
 
+            /**
+             * @brief Sets the sensor whose health counters are attached to every measure uploaded.
+             * @param sensor Pointer to the Sensor object, or `nullptr` to upload only the values.
+             */
+            void setSensor(const Sensor *sensor);
+
             /**
              * @brief Checks if the last update was successful.
              * @return True if the update was successful, false otherwise.
@@ -86,12 +120,46 @@
              */
             bool updateRoom();
 
+            /**
+             * @brief Adds measurement data to the next upload, dropping the oldest if already `API_MANAGEMENT_MAX_MEASURES`.
+             * @param epoch Measurement datetime, as Unix time.
+             * @param temperature Temperature value in Celsius.
+             * @param humidity Humidity value in percentage.
+             */
+            void queueMeasures(uint32_t epoch, double temperature, double humidity);
+
+            /**
+             * @brief Uploads the measurement data queued, clearing them only if the server accepts them with a 2xx.
+             * @return True if the data was successfully uploaded, false otherwise.
+             * @note It logs in only if there is no token yet or the server rejects it, so a sequence of uploads costs one login.
+             */
+            bool sendMeasures();
+
+            /**
+             * @brief Synchronizes the datetime if it is due, then uploads the measurement data queued.
+             * @return True if the data was successfully uploaded, false otherwise.
+             * @note It waits for the server, so call it from a task of its own rather than while handling a measure.
+             */
+            bool upload();
+
+            /**
+             * @brief Checks if measures have been queued since the last upload attempt, while the link is up.
+             * @return True if `upload()` has to be called, false otherwise.
+             */
+            bool isUploadDue() const;
+
+            /**
+             * @brief Gets the number of measures queued for the next upload.
+             * @return The number of measures.
+             */
+            size_t getMeasuresQueued() const;
+
             /**
              * @brief Updates the system status with new sensor values.
              *
              * This method is invoked whenever the observed sensor provides updated data.
-             * It processes the temperature and humidity readings, updates internal states,
-             * and triggers any dependent actions based on the new values.
+             * It queues the temperature and humidity readings when the update interval has elapsed, without any
+             * request to the network: the upload is signalled by `isUploadDue()`.
              *
              * @param temperature The updated temperature value reported by the sensor (in degrees Celsius).
              * @param humidity The updated humidity value reported by the sensor (as a percentage).
@@ -101,13 +169,21 @@
              */
             void update(double temperature, double humidity) override;
 
+            /**
+             * @brief Updates the state of the link, so the requests are attempted only while it is up.
+             * @param isConnected True if the link is up, false otherwise.
+             */
+            void updateLink(bool isConnected) override;
+
         private:
             DatetimeInterval &datetime;                     ///< Reference to the DatetimeInterval object.
+            const Sensor *sensor = nullptr;                 ///< Pointer to the Sensor object, for its health counters.
             WiFiClient wifiClient;                          ///< WiFi client for network communication.
             HTTPClient httpClient;                          ///< HTTP client for API requests.
             StaticJsonDocument<512> jsonDocumentLogin;      ///< JSON document for login operations.
-            StaticJsonDocument<768> jsonDocumentMeasures;   ///< JSON document for measurement data.
-            JsonArray jsonArrayMeasures;                    ///< JSON array for storing measurement data.
+            ApiManagementMeasure measures[API_MANAGEMENT_MAX_MEASURES];    ///< Measures queued, in a ring starting from `measuresFirst`.
+            uint8_t measuresFirst = 0;                      ///< Index of the oldest measure queued.
+            uint8_t measuresCount = 0;                      ///< Number of measures queued.
             String httpJsonResponse;                        ///< Holds server responses.
             String serverAddress;                           ///< API server address.
             uint16_t serverPort;                            ///< API server port.
@@ -116,8 +192,11 @@
             String serverToken;                             ///< Token received after login.
             String serverTokenType;                         ///< Type of token received (e.g., Bearer).
             uint8_t roomNumber;                             ///< Room number identifier.
-            uint8_t maxAttempts;                            ///< Maximum retry attempts.
             bool updateState;                              ///< Indicates whether the last update was successful.
+            bool isLinkUp = false;                          ///< Indicates whether the link notified by WiFiConnection is up.
+            bool isUploadPending = false;                   ///< Indicates whether measures have been queued since the last upload attempt.
+            bool isLoggedIn = false;                        ///< Indicates whether the token of the last login can be used.
+            bool isRoomManaged = false;                     ///< Indicates whether the local IP of the room is kept updated, set by `begin()`.
 
             /**
              * @brief Sends a login request to the server.
@@ -146,19 +225,25 @@
             int requestMeasuresSet(const String &jsonDocumentMeasuresSerialized);
 
             /**
-             * @brief Handles the login process by authenticating with the API.
-             * @return HTTP status code indicating success or failure.
+             * @brief Gets a measure queued.
+             * @param index The index of the measure, from the oldest.
+             * @return The measure.
              */
-            int login();
+            const ApiManagementMeasure &getMeasure(uint8_t index) const;
 
             /**
-             * @brief Adds measurement data to the JSON array.
-             * @param timestamp Measurement timestamp in ISO 8601 format.
-             * @param temperature Temperature value in Celsius.
-             * @param humidity Humidity value in percentage.
-             * @return True if the data was successfully added, false otherwise.
+             * @brief Builds the JSON of the measures queued, in a document that lives only until serialized.
+             * @param jsonDocumentMeasuresSerialized Destination of the serialized JSON string.
+             * @return True if the document has been allocated, false otherwise.
              */
-            bool addMeasures(const String &timestamp, double temperature, double humidity);
+            bool serializeMeasures(String &jsonDocumentMeasuresSerialized);
+
+            /**
+             * @brief Handles the login process by authenticating with the API, with a single attempt.
+             * @return HTTP status code indicating success or failure.
+             * @note The requests are never retried here, so the loop is blocked at most for the timeout: the caller retries later.
+             */
+            int login();
     };
 
 #endif // APIMANAGEMENT_H
@@ -1,7 +1,18 @@
 #ifndef APIMANAGEMENTCONSTS_H
     #define APIMANAGEMENTCONSTS_H
-    const String API_MANAGEMENT_URI_USER_LOGIN =                                "api/user/login";
-    const String API_MANAGEMENT_URI_ROOM_CHANGE_STATE_ACTIVATION =              "api/room/changeStatusActivation";
-    const String API_MANAGEMENT_URI_ROOM_API_CHANGE_LOCAL_IP =                  "api/room/changeLocalIP";
-    const String API_MANAGEMENT_URI_MEASURE_SET =                               "api/measure/set";
+
+    #include <ArduinoJson.h>
+
+    constexpr uint8_t API_MANAGEMENT_MAX_MEASURES = 24;         // Measures kept for the next upload, 4 hours of outage every 10 minutes; the oldest is dropped beyond.
+    constexpr uint8_t API_MANAGEMENT_MEASURE_MEMBERS = 9;       // Members of a measure, with the health counters of the sensor.
+
+    // Memory of a measure in the JSON document built to upload: its members, the timestamp "YYYY-MM-DD HH:MM:SS" and the
+    // two values like "-12.34"; the keys are not copied. The document is freed once serialized.
+    constexpr size_t API_MANAGEMENT_MEASURE_SIZE = JSON_OBJECT_SIZE(API_MANAGEMENT_MEASURE_MEMBERS) + JSON_STRING_SIZE(19) + 2 * JSON_STRING_SIZE(7);
+    constexpr size_t API_MANAGEMENT_MEASURES_CAPACITY = JSON_ARRAY_SIZE(API_MANAGEMENT_MAX_MEASURES) + API_MANAGEMENT_MAX_MEASURES * API_MANAGEMENT_MEASURE_SIZE;
+
+    inline const char API_MANAGEMENT_URI_USER_LOGIN[] PROGMEM =                 "api/user/login";
+    inline const char API_MANAGEMENT_URI_ROOM_CHANGE_STATE_ACTIVATION[] PROGMEM = "api/room/changeStatusActivation";
+    inline const char API_MANAGEMENT_URI_ROOM_API_CHANGE_LOCAL_IP[] PROGMEM =   "api/room/changeLocalIP";
+    inline const char API_MANAGEMENT_URI_MEASURE_SET[] PROGMEM =                "api/measure/set";
 #endif // APIMANAGEMENTCONSTS_H
\ No newline at end of file
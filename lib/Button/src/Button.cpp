@@ -31,6 +31,19 @@ Button::Button(uint8_t pin, input_t mode, uint32_t timeLongPress, longPress_t ty
 
     setPtrActionShort(ptrActionShort);
     setPtrActionLong(ptrActionLong);
+
+    setTimeDebounce(DEFAULT_DEBOUNCE);
+
+    headEdges = 0;
+    tailEdges = 0;
+    isOverflowed = false;
+    isPending = false;
+    levelPending = !valuePress;
+    timePending = 0;
+    isPressedStable = false;
+    timeStartPress = 0;
+    timeLastRelease = 0;
+    isLongPressed = false;
 }
 
 void Button::setTimeLongPress(uint32_t timeLongPress) { this->timeLongPress = timeLongPress; }
@@ -45,69 +58,132 @@ void Button::setPtrActionShort(ptrProcedure ptrActionShort) { this->ptrActionSho
 
 void Button::setPtrActionLong(ptrProcedure ptrActionLong) { this->ptrActionLong = ptrActionLong; }
 
-int8_t Button::checkPress() {   
-    /* Read and save the value for next analysis. */
-    uint8_t valueRead = digitalRead(pin);
-
-    /* Cheching if the button is pressed in this moment. */
-    if (valueRead == valuePress) {
-        /* Checking if is the first press or not. */
-        if (!isPressed) {
-            //Serial.println("1.1");
-            isPressed = true;
-
-            /* Checking if is set the time of long press. If there is a value, will be set the timeout. */
-            if (getTimeLongPress() > DEFAULT_LONG_PRESS) {
-                timeOut = millis() + getTimeLongPress();
-            }
-
-        } else {
-            /* Checking if is the long press. */
-            if ((millis() >= timeOut) && (getTimeLongPress() > DEFAULT_LONG_PRESS) && !isLongPressed) {
-                //Serial.println("2.1");
-                actualValue = -1;
-                isLongPressed = true;
-
-                /* If there is a pointer to a procedure, will be executed. */
-                if (ptrActionLong != NULL) {
-                    ptrActionLong();
-                    
-                    while (valueRead == HIGH); 
-                }
-            } else if (isLongPressed && (getTypeLongPress() == B_NOTCONTINUOUS)) {
-                //Serial.println("2.2");
-                actualValue = 0;
-            } else {
-                //Serial.println("2.3");
-                actualValue = 0;
-            }
-            
+void Button::begin() {
+    isPressedStable = (digitalRead(pin) == valuePress);
+
+    attachInterruptArg(digitalPinToInterrupt(pin), handleInterrupt, this, CHANGE);
+}
+
+void Button::setTimeDebounce(uint32_t timeDebounce) { this->timeDebounce = timeDebounce; }
+
+uint32_t Button::getTimeDebounce() { return timeDebounce; }
+
+bool Button::isPressed() { return isPressedStable; }
+
+bool Button::isIdle() { return !isPressedStable && !isPending && (tailEdges == headEdges); }
+
+uint32_t Button::getTimeLastRelease() { return timeLastRelease; }
+
+int8_t Button::checkPress() {
+    /* If an edge has been lost the queue is not reliable anymore, so the analysis restarts from the actual level. */
+    if (isOverflowed) {
+        tailEdges = headEdges;
+        isOverflowed = false;
+
+        isPending = true;
+        levelPending = digitalRead(pin);
+        timePending = millis();
+    }
+
+    /* Only the interrupt moves the head and only this method moves the tail, so the queue needs no lock. */
+    while (tailEdges != headEdges) {
+        const uint8_t tail = tailEdges;
+        const uint32_t timeEdge = timesEdges[tail];
+        const uint8_t levelEdge = levelsEdges[tail];
+        tailEdges = (tail + 1) & (SIZE_QUEUE_EDGES - 1);
+
+        /* A pending edge followed too early by another one is a bounce, so it is replaced. */
+        const int8_t value = isPending ? acceptPending(timeEdge) : 0;
+        isPending = true;
+        levelPending = levelEdge;
+        timePending = timeEdge;
+
+        if (value != 0) {
+            return notify(value);
         }
-    
-    /* Else, the button is not pressed in this moment. */
-    } else {
-        /* Checking if is the short press, verifying if is set the "TIME_LONG_PRESS" or not. */
-        if (isPressed && (((actualValue != -1) && (millis() < timeOut) && !isLongPressed) || (getTimeLongPress() == DEFAULT_LONG_PRESS))) {
-            //Serial.println("3.1");
-            actualValue = 1;
-            isPressed = false;
-            isLongPressed = false;
-
-            /* If there is a pointer to a procedure, will be executed. */
-            if (ptrActionShort != NULL) {
-                ptrActionShort();
-            }
-
-        /* Else, is not a press. */
-        } else {
-            //Serial.println("3.2");
-            actualValue = 0;
-            isPressed = false;
-            isLongPressed = false;
+    }
+
+    const uint32_t now = millis();
+    if (isPending) {
+        const int8_t value = acceptPending(now);
+        if (value != 0) {
+            return notify(value);
+        }
+    }
+
+    /* Checking if is the long press, unless a release is waiting its debounce time. */
+    if (isPressedStable && (getTimeLongPress() > DEFAULT_LONG_PRESS) && (now - timeStartPress >= getTimeLongPress()) && !(isPending && levelPending != valuePress)) {
+        if (!isLongPressed) {
+            isLongPressed = true;
+            return notify(-1);
         }
+
+        if (getTypeLongPress() == B_CONTINUOUS) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+void IRAM_ATTR Button::handleInterrupt(void *button) {
+    Button *self = static_cast<Button *>(button);
+
+    const uint8_t head = self->headEdges;
+    const uint8_t next = (head + 1) & (SIZE_QUEUE_EDGES - 1);
+    if (next == self->tailEdges) {
+        self->isOverflowed = true;
+        return;
+    }
+
+    self->timesEdges[head] = millis();
+    self->levelsEdges[head] = digitalRead(self->pin);
+    self->headEdges = next;
+}
+
+int8_t Button::acceptPending(uint32_t now) {
+    if (now - timePending < timeDebounce) {
+        return 0;
+    }
+    isPending = false;
+
+    const bool isPressedPending = (levelPending == valuePress);
+    if (isPressedPending == isPressedStable) {
+        return 0;
+    }
+    isPressedStable = isPressedPending;
+
+    if (isPressedStable) {
+        timeStartPress = timePending;
+        isLongPressed = false;
+
+        return 0;
+    }
+    timeLastRelease = timePending;
+
+    /* The press has already been returned as long while held. */
+    if (isLongPressed) {
+        return 0;
+    }
+
+    /* The duration comes from the times of the edges, so it is right even if "checkPress" has been called late. */
+    if ((getTimeLongPress() > DEFAULT_LONG_PRESS) && (timePending - timeStartPress >= getTimeLongPress())) {
+        isLongPressed = true;
+        return -1;
+    }
+
+    return 1;
+}
+
+int8_t Button::notify(int8_t value) {
+    /* If there is a pointer to a procedure, will be executed. */
+    if ((value == 1) && (ptrActionShort != NULL)) {
+        ptrActionShort();
+    } else if ((value == -1) && (ptrActionLong != NULL)) {
+        ptrActionLong();
     }
 
-    return actualValue;
+    return value;
 }
 
 void Button::setMode(input_t mode) {
@@ -2,14 +2,16 @@
   * @brief This library allows to manage a button.
   * It can specify if the pressure is long or not. Morevoer, is possible to assign a time (in milliseconds) to consider the long press, 
   * and a specific procedure both for short and long press. For short press there is the debouncing.
+  * The edges are captured by an interrupt into a queue of timestamps, then debounced and classified outside the interrupt by "checkPress",
+  * so a press is measured correctly even if "loop" is blocked for seconds.
   * Copyright (c) 2022 Davide Palladino.
   * All right reserved.
   * 
   * @author Davide Palladino
   * @contact davidepalladino@hotmail.com
   * @website https://davidepalladino.github.io/
-  * @version 2.0.2
-  * @date 30th September, 2022
+  * @version 3.1.0
+  * @date 18th October 2026
   * 
   */
 
@@ -21,6 +23,8 @@
     #endif
 
     #define DEFAULT_LONG_PRESS 0                                                                // Default value in milliseconds for the long press.
+    #define DEFAULT_DEBOUNCE 30                                                                 // Default time in milliseconds of stable level to accept an edge.
+    #define SIZE_QUEUE_EDGES 16                                                                 // Number of edges kept between two calls of "checkPress"; must be a power of two.
 
     typedef enum input : uint8_t {B_PULLUP, B_NOPULLUP} input_t;                                // Symbolic constants to indicate, respectively, if is "INPUT_PULLUP" or "INPUT".
     typedef enum longPress : uint8_t {B_CONTINUOUS, B_NOTCONTINUOUS} longPress_t;               // Symbolic constants to indicate if the long press will be considered continuous or not.
@@ -126,6 +130,23 @@
              */
             Button(uint8_t pin, input_t mode, uint32_t timeLongPress, longPress_t typeLongPress, ptrProcedure ptrActionShort, ptrProcedure ptrActionLong);
 
+            /**
+             * @brief This method attaches the interrupt of the pin, that captures the edges. It must be called before "checkPress", in "setup".
+             */
+            void begin();
+
+            /**
+             * @brief This method sets the time of stable level to accept an edge, filtering the bounces of the contacts.
+             * @param timeDebounce Time in milliseconds.
+             */
+            void setTimeDebounce(uint32_t timeDebounce);
+
+            /**
+             * @brief This method gets the time of stable level to accept an edge.
+             * @return Time in milliseconds.
+             */
+            uint32_t getTimeDebounce();
+
             /**
              * @brief This method sets the time for the long press.
              * @param timeLongPress Time in milliseconds for long press.
@@ -163,11 +184,31 @@
             void setPtrActionLong(ptrProcedure ptrActionLong);          
 
             /**
-             * @brief This method gets the actual press, both for short and long. For short press there is the debouncing.
+             * @brief This method gets the actual press, both for short and long, from the edges captured since the previous call.
+             * The duration of the press is measured with the times of the edges, not of the calls. If more presses are queued, one is returned per call.
+             * The long press is returned as soon as its time is elapsed, without waiting the release; if continuous, it is returned on every call while held.
              * @return Value -1 if the pressure is long; 0 if there is not any pressure; 1 if the pressure is short.
              */     
             int8_t checkPress();
 
+            /**
+             * @brief This method gets if the button is pressed, after the debouncing.
+             * @return True if pressed, false otherwise.
+             */
+            bool isPressed();
+
+            /**
+             * @brief This method gets if the button is released, with no edge still to analyse.
+             * @return True if idle, false otherwise.
+             */
+            bool isIdle();
+
+            /**
+             * @brief This method gets the time of the end of the last press, taken by the interrupt.
+             * @return Time in milliseconds.
+             */
+            uint32_t getTimeLastRelease();
+
         private:
             uint8_t pin;                                // Pin of the button to read the status.
             uint8_t mode;                               // Mode of the input, between "INPUT" (with "B_NOPULLUP" constant) and "INPUT_PULLUP" (with "B_PULLUP" constant).
@@ -176,10 +217,39 @@
             ptrProcedure ptrActionLong;                 // Pointer to a procedure for short press.
             ptrProcedure ptrActionShort;                // Pointer to a procedure for long press.
             uint8_t valuePress;                         // This variable will contain the value where the button will be considered pressed. In example, "HIGH" if the "pinMode" is set to "INPUT"; "LOW" if the "pinMode" is set to "INPUT_PULLUP".
-            uint32_t timeOut;                           // End of time, calculated with the actual time plus "TIME_LONG_PRESS".
-            bool isPressed;                             // Flag to indicate if the button was already pressed.
-            bool isLongPressed;                         // Flag to indicate if the last press was long or not.
-            int8_t actualValue;                         // Actual value of the button.
+            uint32_t timeDebounce;                      // Time in milliseconds of stable level to accept an edge.
+            volatile uint32_t timesEdges[SIZE_QUEUE_EDGES]; // Times in milliseconds of the edges, written by the interrupt.
+            volatile uint8_t levelsEdges[SIZE_QUEUE_EDGES]; // Levels read after the edges, written by the interrupt.
+            volatile uint8_t headEdges;                 // Index of the next edge to write, changed only by the interrupt.
+            volatile uint8_t tailEdges;                 // Index of the next edge to read, changed only by "checkPress".
+            volatile bool isOverflowed;                 // Flag to indicate if an edge has been lost because the queue was full.
+            bool isPending;                             // Flag to indicate if there is an edge waiting its debounce time.
+            uint8_t levelPending;                       // Level of the edge waiting its debounce time.
+            uint32_t timePending;                       // Time in milliseconds of the edge waiting its debounce time.
+            bool isPressedStable;                       // Flag to indicate if the button is pressed, after the debouncing.
+            uint32_t timeStartPress;                    // Time in milliseconds of the start of the actual press.
+            uint32_t timeLastRelease;                   // Time in milliseconds of the end of the last press.
+            bool isLongPressed;                         // Flag to indicate if the actual press has already been returned as long.
+
+            /**
+             * @brief This procedure is the interrupt of the pin, that queues the time and the level of the edge.
+             * @param button Pointer to the Button of the pin.
+             */
+            static void handleInterrupt(void *button);
+
+            /**
+             * @brief This method accepts the pending edge if its level has been stable for the debounce time, classifying the press.
+             * @param now Time in milliseconds of the next edge, or the actual time.
+             * @return Value -1 if the pressure is long; 0 if there is not any pressure; 1 if the pressure is short.
+             */
+            int8_t acceptPending(uint32_t now);
+
+            /**
+             * @brief This method calls the procedure of the press, if set.
+             * @param value Value of the press, as returned by "checkPress".
+             * @return The same value.
+             */
+            int8_t notify(int8_t value);
 
             /**
              * @brief This method sets the input mode.
@@ -0,0 +1,107 @@
+#include "ButtonGesture.h"
+
+ButtonGesture::ButtonGesture(Button &button) : ButtonGesture(button, DEFAULT_MULTI_CLICK, DEFAULT_REPEAT) {}
+
+ButtonGesture::ButtonGesture(Button &button, uint32_t timeMultiClick, uint32_t timeRepeat) : button(button) {
+    setTimeMultiClick(timeMultiClick);
+    setTimeRepeat(timeRepeat);
+    setPtrAction(NULL);
+
+    clicks = 0;
+    timeLastClick = 0;
+    isHolding = false;
+    timeLastRepeat = 0;
+    gesturePending = G_NONE;
+}
+
+void ButtonGesture::setTimeMultiClick(uint32_t timeMultiClick) { this->timeMultiClick = timeMultiClick; }
+
+uint32_t ButtonGesture::getTimeMultiClick() { return timeMultiClick; }
+
+void ButtonGesture::setTimeRepeat(uint32_t timeRepeat) { this->timeRepeat = timeRepeat; }
+
+uint32_t ButtonGesture::getTimeRepeat() { return timeRepeat; }
+
+void ButtonGesture::setPtrAction(ptrGesture ptrAction) { this->ptrAction = ptrAction; }
+
+gesture_t ButtonGesture::check() {
+    if (gesturePending != G_NONE) {
+        const gesture_t gesture = gesturePending;
+        gesturePending = G_NONE;
+
+        return notify(gesture);
+    }
+
+    switch (button.checkPress()) {
+        case 1: {
+            /* A click released too late after the previous one starts a new sequence, so the previous is returned now. */
+            const uint32_t timeRelease = button.getTimeLastRelease();
+            gesture_t gesture = G_NONE;
+            if ((clicks > 0) && (timeRelease - timeLastClick > getTimeMultiClick())) {
+                gesture = takeClicks();
+            }
+
+            clicks++;
+            timeLastClick = timeRelease;
+
+            /* No gesture has more clicks, so there is no reason to wait for another one. */
+            if (clicks == 3) {
+                if (gesture != G_NONE) {
+                    gesturePending = takeClicks();
+                } else {
+                    gesture = takeClicks();
+                }
+            }
+
+            return notify(gesture);
+        }
+
+        case -1: {
+            isHolding = true;
+            timeLastRepeat = millis();
+
+            /* The long press ends the sequence of clicks before it, returned first. */
+            if (clicks > 0) {
+                gesturePending = G_LONG_PRESS;
+                return notify(takeClicks());
+            }
+
+            return notify(G_LONG_PRESS);
+        }
+
+        default:
+            break;
+    }
+
+    if (isHolding) {
+        if (!button.isPressed()) {
+            isHolding = false;
+        } else if (millis() - timeLastRepeat >= getTimeRepeat()) {
+            timeLastRepeat = millis();
+            return notify(G_HOLD_REPEAT);
+        }
+    }
+
+    /* The clicks are returned only when no edge waits to be analysed, otherwise a late loop would split a double click. */
+    if ((clicks > 0) && button.isIdle() && (millis() - timeLastClick > getTimeMultiClick())) {
+        return notify(takeClicks());
+    }
+
+    return G_NONE;
+}
+
+gesture_t ButtonGesture::takeClicks() {
+    const gesture_t gesture = (clicks >= 3) ? G_TRIPLE_CLICK : ((clicks == 2) ? G_DOUBLE_CLICK : G_CLICK);
+    clicks = 0;
+
+    return gesture;
+}
+
+gesture_t ButtonGesture::notify(gesture_t gesture) {
+    /* If there is a pointer to a procedure, will be executed. */
+    if ((gesture != G_NONE) && (ptrAction != NULL)) {
+        ptrAction(gesture);
+    }
+
+    return gesture;
+}
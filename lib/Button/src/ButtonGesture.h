@@ -0,0 +1,111 @@
+ /**
+  * @brief This library recognizes the gestures made with a button: single, double and triple click, long press and hold with repeat.
+  * It works on the presses returned by "Button", so it never waits: a click is returned once the time for another click is elapsed,
+  * a double or triple click as soon as recognized. The times of the clicks are taken by the interrupt of "Button".
+  * Copyright (c) 2025 Davide Palladino.
+  * All right reserved.
+  * 
+  * @author Davide Palladino
+  * @contact davidepalladino@hotmail.com
+  * @website https://davidepalladino.github.io/
+  * @version 1.0.0
+  * @date 18th October 2026
+  * 
+  */
+
+#ifndef BUTTONGESTURE_H
+    #define BUTTONGESTURE_H
+
+    #ifndef ARDUINO_H
+        #include <Arduino.h>
+    #endif
+
+    #include "Button.h"
+
+    #define DEFAULT_MULTI_CLICK 300                                                             // Default time in milliseconds between the release of a click and the next one.
+    #define DEFAULT_REPEAT 500                                                                  // Default time in milliseconds between the repeats of a hold.
+
+    typedef enum gesture : uint8_t {G_NONE, G_CLICK, G_DOUBLE_CLICK, G_TRIPLE_CLICK, G_LONG_PRESS, G_HOLD_REPEAT} gesture_t;    // Symbolic constants of the gestures.
+
+    /**
+     *  @brief Poiter type to a procedure that receives the gesture recognized, assigned through "setPtrAction".
+     */
+    typedef void (*ptrGesture) (gesture_t);
+
+    class ButtonGesture {
+        public:
+            /** 
+             * @brief This constructor creates the object on a button, with the default times.
+             * @param button Button to analyse; its time of long press is the time of the long press gesture.
+             */
+            ButtonGesture(Button &button);
+
+            /** 
+             * @brief This constructor creates the object on a button.
+             * @param button Button to analyse; its time of long press is the time of the long press gesture.
+             * @param timeMultiClick Time in milliseconds between the release of a click and the next one, to be joined.
+             * @param timeRepeat Time in milliseconds between the repeats, while the button is held after a long press.
+             */
+            ButtonGesture(Button &button, uint32_t timeMultiClick, uint32_t timeRepeat);
+
+            /**
+             * @brief This method sets the time between the release of a click and the next one, to be joined.
+             * @param timeMultiClick Time in milliseconds.
+             */
+            void setTimeMultiClick(uint32_t timeMultiClick);
+
+            /**
+             * @brief This method gets the time between the release of a click and the next one, to be joined.
+             * @return Time in milliseconds.
+             */
+            uint32_t getTimeMultiClick();
+
+            /**
+             * @brief This method sets the time between the repeats, while the button is held after a long press.
+             * @param timeRepeat Time in milliseconds.
+             */
+            void setTimeRepeat(uint32_t timeRepeat);
+
+            /**
+             * @brief This method gets the time between the repeats, while the button is held after a long press.
+             * @return Time in milliseconds.
+             */
+            uint32_t getTimeRepeat();
+
+            /**
+             * @brief This method sets the pointer to the procedure called for every gesture recognized.
+             * @param ptrAction Pointer to the procedure, "NULL" to remove it.
+             */
+            void setPtrAction(ptrGesture ptrAction);
+
+            /**
+             * @brief This method analyses the presses of the button and gets the gesture recognized, if any. It must be called once per loop and never blocks.
+             * @return The gesture recognized, "G_NONE" if there is not any gesture.
+             */
+            gesture_t check();
+
+        private:
+            Button &button;                             // Button analysed.
+            uint32_t timeMultiClick;                    // Time in milliseconds between the release of a click and the next one, to be joined.
+            uint32_t timeRepeat;                        // Time in milliseconds between the repeats of a hold.
+            ptrGesture ptrAction;                       // Pointer to a procedure for the gestures.
+            uint8_t clicks;                             // Number of clicks joined, not yet returned.
+            uint32_t timeLastClick;                     // Time in milliseconds of the release of the last click.
+            bool isHolding;                             // Flag to indicate if the button is held after a long press.
+            uint32_t timeLastRepeat;                    // Time in milliseconds of the long press or of the last repeat.
+            gesture_t gesturePending;                   // Gesture recognized together with the clicks, returned by the next call.
+
+            /**
+             * @brief This method gets the gesture of the clicks joined, clearing them.
+             * @return The gesture of the clicks.
+             */
+            gesture_t takeClicks();
+
+            /**
+             * @brief This method calls the procedure of the gestures, if set.
+             * @param gesture Gesture recognized.
+             * @return The same gesture.
+             */
+            gesture_t notify(gesture_t gesture);
+    };
+#endif
@@ -1,7 +1,7 @@
 #include "Configuration.h"
 
-void configurationVersion1(Button &button, Screen &screen) {
-    int8_t resultButton = 0;
+void configurationVersion1(ButtonGesture &buttonGesture, Screen &screen, WiFiConnection &wifiConnection) {
+    gesture_t resultGesture = G_NONE;
 
     /* Reset EEPROM to avoid some conflict. */
     resetEEPROM(SIZE_EEPROM);
@@ -11,8 +11,19 @@ void configurationVersion1(Button &button, Screen &screen) {
     do {
         yield();
 
-        resultButton = button.checkPress();
-        if (resultButton == 1) {
+        resultGesture = buttonGesture.check();
+
+        /* Every click of a double or triple click moves to the next room. */
+        uint8_t steps = 0;
+        if (resultGesture == G_CLICK) {
+            steps = 1;
+        } else if (resultGesture == G_DOUBLE_CLICK) {
+            steps = 2;
+        } else if (resultGesture == G_TRIPLE_CLICK) {
+            steps = 3;
+        }
+
+        for (uint8_t i = 0; i < steps; i++) {
             if (roomID == MAX_ROOM_NUMBER) {
                 roomID = MIN_ROOM_NUMBER;
             } else {
@@ -22,34 +33,39 @@ void configurationVersion1(Button &button, Screen &screen) {
 
         screen.setRoomNumber(roomID);
         screen.showInstallationRoomIDPage(installationRoomIDPageMessages);
-    } while (resultButton != -1);
+    } while (resultGesture != G_LONG_PRESS);
 
     // WiFi
     char wifiSSID[SIZE_WIFI_SSID];
     char wifiPassword[SIZE_WIFI_PASSWORD];
+    wifiConnectionEvent_t resultConnection = WIFI_CONNECTION_EVENT_NONE;
     do {
         yield();
         screen.showInstallationWiFiPage(installationRoomWiFiPageMessages, 1);
         do {
             yield();
-            resultButton = button.checkPress();
-        } while (resultButton != 1);
+            resultGesture = buttonGesture.check();
+        } while (resultGesture != G_CLICK);
 
         screen.showInstallationWiFiPage(installationRoomWiFiPageMessages, 2);
 
-        if (WiFi.beginWPSConfig()) {
-            if (WiFi.SSID().length() > 0) {
-                WiFi.SSID().toCharArray(wifiSSID, SIZE_WIFI_SSID);
-                WiFi.psk().toCharArray(wifiPassword, SIZE_WIFI_PASSWORD);
-
-                break;
-            }
+        /* The WPS goes on in background, so the loop keeps yielding to the SDK meanwhile. */
+        resultConnection = WIFI_CONNECTION_EVENT_WPS_FAILURE;
+        if (wifiConnection.beginWPS()) {
+            do {
+                delay(10);
+                resultConnection = wifiConnection.check();
+            } while (resultConnection != WIFI_CONNECTION_EVENT_WPS_SUCCESS && resultConnection != WIFI_CONNECTION_EVENT_WPS_FAILURE);
+        }
 
+        if (resultConnection == WIFI_CONNECTION_EVENT_WPS_SUCCESS) {
+            wifiConnection.getSSID().toCharArray(wifiSSID, SIZE_WIFI_SSID);
+            wifiConnection.getPassword().toCharArray(wifiPassword, SIZE_WIFI_PASSWORD);
+        } else {
             screen.showInstallationWiFiPage(installationRoomWiFiPageMessages, 3);
             delay(TIME_MESSAGE);
         }
-
-    } while (WiFi.status() != WL_CONNECTED);
+    } while (resultConnection != WIFI_CONNECTION_EVENT_WPS_SUCCESS);
 
     // EEPROM
     EEPROM.put(ADDRESS_VERSION_EEPROM, VERSION_EEPROM);
@@ -59,7 +75,7 @@ void configurationVersion1(Button &button, Screen &screen) {
     EEPROM.commit();
 }
 
-void configurationVersion3(ServerSocketJSON &serverSocket, Screen &screen, ApiManagement &apiManagement) {
+void configurationVersion3(ServerSocketJSON &serverSocket, Screen &screen, ApiManagement &apiManagement, WiFiConnection &wifiConnection) {
     char wifiSSID[SIZE_WIFI_SSID];
     char wifiPassword[SIZE_WIFI_PASSWORD];
     uint8_t roomID = 0;
@@ -92,7 +108,7 @@ void configurationVersion3(ServerSocketJSON &serverSocket, Screen &screen, ApiMa
     EEPROM.get(ADDRESS_ROOM_ID, roomID);
 
     /* Forcing Wi-Fi and server connection and showing an instruction message. */
-    forceConnectWiFi(String(wifiSSID), String(wifiPassword), roomID);
+    forceConnectWiFi(wifiConnection, String(wifiSSID), String(wifiPassword), roomID);
     screen.showUpgradeVersionThreePage(upgradeConfigurationToVersionTwoMessages, WiFi.localIP().toString());
 
     serverSocket.begin(SERVER_SOCKET_PORT);
@@ -112,7 +128,7 @@ void configurationVersion3(ServerSocketJSON &serverSocket, Screen &screen, ApiMa
     EEPROM.commit();
 }
 
-void configurationLoad(FirmwareUpdateOTA firmwareUpdateOta, ServerSocketJSON &serverSocket, Sensor &sensor, Screen &screen, ApiManagement &apiManagement, String &wifiSSID, String &wifiPassword) {
+bool configurationLoad(FirmwareUpdateOTA firmwareUpdateOta, ServerSocketJSON &serverSocket, Sensor &sensor, Screen &screen, ApiManagement &apiManagement, WiFiConnection &wifiConnection) {
     constexpr float percentageLoadingMessage = static_cast<float>(100) / ((static_cast<float>(sizeof(loadingPageMessages)) / sizeof(loadingPageMessages[0])) - 1);
     uint8_t iLoadingMessages = 0;
 
@@ -130,27 +146,28 @@ void configurationLoad(FirmwareUpdateOTA firmwareUpdateOta, ServerSocketJSON &se
     EEPROM.get(ADDRESS_ROOM_ID, roomID);
     EEPROM.get(ADDRESS_CREDENTIAl_USERNAME, c_credentialUsername);
     EEPROM.get(ADDRESS_CREDENTIAL_PASSWORD, c_credentialPassword);
-    wifiSSID = c_wifiSSID;
-    wifiPassword = c_wifiPassword;
     delay(calculateDelay(static_cast<long>(timeStartedLoadingMessage), TIME_LOADING_MESSAGE));
 
     // WiFi
     iLoadingMessages++;
     timeStartedLoadingMessage = millis();
     screen.showLoadingPage(loadingPageMessages[iLoadingMessages], (percentageLoadingMessage * static_cast<float>(iLoadingMessages)));
-    forceConnectWiFi(wifiSSID, wifiPassword, roomID);
+    beginConnectWiFi(wifiConnection, String(c_wifiSSID), String(c_wifiPassword), roomID);
+    while (!wifiConnection.isConnected() && (millis() - timeStartedLoadingMessage) < TIMEOUT_WIFI_LOADING) {
+        wifiConnection.check();
+        delay(10);
+    }
+    if (wifiConnection.isConnected()) {
+        saveWiFiCache(wifiConnection);
+    }
     serverSocket.begin(SERVER_SOCKET_PORT);
     delay(calculateDelay(static_cast<long>(timeStartedLoadingMessage), TIME_LOADING_MESSAGE));
 
-    // FIRMWARE
+    // FIRMWARE, only if the network is there; otherwise the check is left to `configurationLoadNetwork()`.
     iLoadingMessages++;
     timeStartedLoadingMessage = millis();
     screen.showLoadingPage(loadingPageMessages[iLoadingMessages], (percentageLoadingMessage * static_cast<float>(iLoadingMessages)));
-    firmwareUpdateOta.begin(FIRMWARE_UPDATE_OTA_BASE_ADDRESS, FIRMWARE_UPDATE_OTA_BASE_PORT);
-    if (firmwareUpdateOta.check(VERSION_FIRMWARE)) {
-        screen.showMessagePage(messagePageFirmwareUpdated);
-        EspClass::restart();
-    }
+    const bool isNetworkLoaded = configurationLoadNetwork(firmwareUpdateOta, screen, wifiConnection);
     delay(calculateDelay(static_cast<long>(timeStartedLoadingMessage), TIME_LOADING_MESSAGE));
 
     // API
@@ -159,7 +176,7 @@ void configurationLoad(FirmwareUpdateOTA firmwareUpdateOta, ServerSocketJSON &se
     screen.showLoadingPage(loadingPageMessages[iLoadingMessages], (percentageLoadingMessage * static_cast<float>(iLoadingMessages)));
     apiManagement.setRoomNumber(roomID);
     apiManagement.setCredentials(String(c_credentialUsername), String(c_credentialPassword));
-    apiManagement.begin(API_MANAGEMENT_BASE_ADDRESS, API_MANAGEMENT_BASE_PORT, API_MANAGEMENT_MAX_ATTEMPTS, API_MANAGEMENT_MINUTES_UPDATE_MEASURES);
+    apiManagement.begin(FPSTR(API_MANAGEMENT_BASE_ADDRESS), API_MANAGEMENT_BASE_PORT, API_MANAGEMENT_TIMEOUT, API_MANAGEMENT_MINUTES_UPDATE_MEASURES);
     delay(calculateDelay(static_cast<long>(timeStartedLoadingMessage), TIME_LOADING_MESSAGE));
 
     // Sensor
@@ -172,6 +189,133 @@ void configurationLoad(FirmwareUpdateOTA firmwareUpdateOta, ServerSocketJSON &se
     // Screen
     screen.showLoadingPage(loadingPageMessages[iLoadingMessages], (percentageLoadingMessage * static_cast<float>(iLoadingMessages)));
     screen.setRoomNumber(roomID);
-    screen.isConnected(WiFi.isConnected());
     screen.isUpdated(apiManagement.isUpdated());
-}
\ No newline at end of file
+
+    return isNetworkLoaded;
+}
+
+void configurationLoadFast(ServerSocketJSON &serverSocket, Sensor &sensor, Screen &screen, ApiManagement &apiManagement, WiFiConnection &wifiConnection) {
+    constexpr float percentageLoadingMessage = static_cast<float>(100) / ((static_cast<float>(sizeof(loadingPageMessages)) / sizeof(loadingPageMessages[0])) - 1);
+
+    uint8_t roomID = MIN_ROOM_NUMBER;
+    char c_wifiSSID[SIZE_WIFI_SSID];
+    char c_wifiPassword[SIZE_WIFI_PASSWORD];
+    char c_credentialUsername[SERVER_SOCKET_SIZE_USERNAME];
+    char c_credentialPassword[SERVER_SOCKET_SIZE_PASSWORD];
+
+    // EEPROM
+    EEPROM.get(ADDRESS_WIFI_SSID, c_wifiSSID);
+    EEPROM.get(ADDRESS_WIFI_PASSWORD, c_wifiPassword);
+    EEPROM.get(ADDRESS_ROOM_ID, roomID);
+    EEPROM.get(ADDRESS_CREDENTIAl_USERNAME, c_credentialUsername);
+    EEPROM.get(ADDRESS_CREDENTIAL_PASSWORD, c_credentialPassword);
+
+    // WiFi, first, since the association is the longest stage and goes on by itself.
+    beginConnectWiFi(wifiConnection, String(c_wifiSSID), String(c_wifiPassword), roomID);
+    screen.showLoadingPage(loadingPageMessages[1], percentageLoadingMessage);
+    serverSocket.begin(SERVER_SOCKET_PORT);
+
+    // API
+    screen.showLoadingPage(loadingPageMessages[3], percentageLoadingMessage * 3);
+    apiManagement.setRoomNumber(roomID);
+    apiManagement.setCredentials(String(c_credentialUsername), String(c_credentialPassword));
+    apiManagement.begin(FPSTR(API_MANAGEMENT_BASE_ADDRESS), API_MANAGEMENT_BASE_PORT, API_MANAGEMENT_TIMEOUT, API_MANAGEMENT_MINUTES_UPDATE_MEASURES);
+
+    // Sensor
+    screen.showLoadingPage(loadingPageMessages[4], percentageLoadingMessage * 4);
+    sensor.begin();
+
+    // Screen
+    screen.showLoadingPage(loadingPageMessages[5], percentageLoadingMessage * 5);
+    screen.setRoomNumber(roomID);
+    screen.isUpdated(false);
+}
+
+bool configurationLoadNetwork(FirmwareUpdateOTA &firmwareUpdateOta, Screen &screen, const WiFiConnection &wifiConnection) {
+    if (!wifiConnection.isConnected()) {
+        return false;
+    }
+
+    // FIRMWARE
+    firmwareUpdateOta.begin(FPSTR(FIRMWARE_UPDATE_OTA_BASE_ADDRESS), FIRMWARE_UPDATE_OTA_BASE_PORT);
+    if (firmwareUpdateOta.check(FPSTR(VERSION_FIRMWARE))) {
+        screen.wake();
+        screen.showMessagePage(messagePageFirmwareUpdated);
+        EspClass::restart();
+    }
+
+    return true;
+}
+
+void configurationBatch(SleepBatch &sleepBatch, Sensor &sensor, DatetimeInterval &datetimeInterval, ApiManagement &apiManagement, WiFiConnection &wifiConnection) {
+    if (!sleepBatch.begin()) {
+        Serial.println(F("\033[1;91m[SLEEP BATCH ERROR: RTC MEMORY NOT VALID, BATCH CLEARED]\033[0m"));
+    }
+    Serial.println("\nBatch wake: " + String(sleepBatch.getWakes()) + ", samples: " + String(sleepBatch.size()) + ", last boot to sleep: " + String(sleepBatch.getTimeBootLast()) + " us");
+
+    // Sample
+    datetimeInterval.beginOffline();
+    sensor.begin();
+    const unsigned long timeStartedSample = millis();
+    bool isSampled = false;
+    while (!isSampled && (millis() - timeStartedSample) < BATCH_TIMEOUT_SAMPLE) {
+        delay(sensor.getTimeToNextCheck());
+        isSampled = sensor.check();
+    }
+    if (isSampled) {
+        sleepBatch.add(datetimeInterval.getActualEpoch(), sensor.getTemperature(), sensor.getHumidity());
+    } else {
+        Serial.println(F("\033[1;91m[SLEEP BATCH ERROR: SAMPLE NOT TAKEN]\033[0m"));
+    }
+
+    // Upload
+    if (sleepBatch.isUploadDue() && sleepBatch.size() > 0) {
+        uint8_t roomID = MIN_ROOM_NUMBER;
+        char c_wifiSSID[SIZE_WIFI_SSID];
+        char c_wifiPassword[SIZE_WIFI_PASSWORD];
+        char c_credentialUsername[SERVER_SOCKET_SIZE_USERNAME];
+        char c_credentialPassword[SERVER_SOCKET_SIZE_PASSWORD];
+        EEPROM.get(ADDRESS_WIFI_SSID, c_wifiSSID);
+        EEPROM.get(ADDRESS_WIFI_PASSWORD, c_wifiPassword);
+        EEPROM.get(ADDRESS_ROOM_ID, roomID);
+        EEPROM.get(ADDRESS_CREDENTIAl_USERNAME, c_credentialUsername);
+        EEPROM.get(ADDRESS_CREDENTIAL_PASSWORD, c_credentialPassword);
+
+        wifiConnection.addObserver(&apiManagement);
+        beginConnectWiFi(wifiConnection, String(c_wifiSSID), String(c_wifiPassword), roomID, sleepBatch.getWiFiDirected());
+        const unsigned long timeStartedWiFi = millis();
+        while (!wifiConnection.isConnected() && (millis() - timeStartedWiFi) < BATCH_TIMEOUT_WIFI) {
+            wifiConnection.check();
+            delay(10);
+        }
+        sleepBatch.setWiFiDirected(wifiConnection.getDirected());
+
+        if (wifiConnection.isConnected()) {
+            saveWiFiCache(wifiConnection);
+
+            apiManagement.setRoomNumber(roomID);
+            apiManagement.setCredentials(String(c_credentialUsername), String(c_credentialPassword));
+            apiManagement.setServer(FPSTR(API_MANAGEMENT_BASE_ADDRESS), API_MANAGEMENT_BASE_PORT, API_MANAGEMENT_TIMEOUT);
+
+            /* Every chunk is removed only once uploaded, so a failure keeps the rest for the next upload. */
+            while (sleepBatch.size() > 0) {
+                const uint8_t chunk = min(sleepBatch.size(), API_MANAGEMENT_MAX_MEASURES);
+                for (uint8_t i = 0; i < chunk; i++) {
+                    const SleepBatchSample sample = sleepBatch.get(i);
+                    apiManagement.queueMeasures(sample.epoch, sample.temperature / 10.0, sample.humidity / 10.0);
+                }
+
+                if (!apiManagement.sendMeasures()) {
+                    break;
+                }
+                sleepBatch.remove(chunk);
+            }
+        } else {
+            Serial.println(F("\033[1;91m[SLEEP BATCH ERROR: WIFI NOT CONNECTED]\033[0m"));
+        }
+    }
+
+    // Deep Sleep
+    Serial.println("Boot to sleep: " + String(micros()) + " us");
+    sleepBatch.sleep(BATCH_TIME_SLEEP);
+}
@@ -14,17 +14,18 @@
  * 1. **EEPROM Reset:** Clears the EEPROM to avoid potential conflicts with previously stored data.
  * 2. **Room ID Setup:**
  *    - Displays the room ID configuration screen.
- *    - The user can cycle through valid room numbers using the button.
+ *    - The user can cycle through valid room numbers using the button, by one number per click.
  *    - Selection is finalized when the button is held for a long press.
  * 3. **Wi-Fi Setup:**
- *    - Prompts the user to initiate WPS (Wi-Fi Protected Setup).
+ *    - Prompts the user to initiate WPS (Wi-Fi Protected Setup), with a click; the WPS runs in background.
  *    - If the credentials are successfully retrieved, they are stored in EEPROM.
  *    - If the process fails, the user is prompted to retry.
  * 4. **EEPROM Commit:**
  *    - Saves the collected data (version, Wi-Fi credentials, and room ID) into EEPROM for persistent storage.
  *
- * @param button Reference to the Button object used for user interaction during installation.
+ * @param buttonGesture Reference to the gestures of the button used for user interaction during installation.
  * @param screen Reference to the Screen object used for displaying messages and installation steps.
+ * @param wifiConnection Reference to the WiFiConnection object that runs the WPS.
  *
  * @warning The EEPROM must be initialized (opened) before calling this function to ensure proper operation.
  *
@@ -34,7 +35,7 @@
  *
  * @return None (void)
  */
-void configurationVersion1(Button &button, Screen &screen);
+void configurationVersion1(ButtonGesture &buttonGesture, Screen &screen, WiFiConnection &wifiConnection);
 
 /**
  * @brief Upgrades the system to version 3 by storing Wi-Fi credentials using an Android app via socket communication.
@@ -61,6 +62,7 @@ void configurationVersion1(Button &button, Screen &screen);
  * @param serverSocket Reference to the ServerSocketJSON object to open a server socket and communicate with the Android app.
  * @param screen Reference to the Screen object used to visualize the status of the upgrade process.
  * @param apiManagement Reference to the ApiManagement object for handling the received credentials.
+ * @param wifiConnection Reference to the WiFiConnection object that manages the connection.
  *
  * @warning The EEPROM must be initialized (opened) before calling this function to ensure proper operation.
  *
@@ -70,7 +72,7 @@ void configurationVersion1(Button &button, Screen &screen);
  *
  * @return None (void)
  */
-void configurationVersion3(ServerSocketJSON &serverSocket, Screen &screen, ApiManagement &apiManagement);
+void configurationVersion3(ServerSocketJSON &serverSocket, Screen &screen, ApiManagement &apiManagement, WiFiConnection &wifiConnection);
 
 /**
  * @brief Loads the system configuration and initializes essential components.
@@ -84,14 +86,13 @@ void configurationVersion3(ServerSocketJSON &serverSocket, Screen &screen, ApiMa
  *    - Reads Wi-Fi credentials, room ID, and API credentials from EEPROM.
  *    - Converts stored character arrays to `String` objects for easier handling.
  * 2. **Wi-Fi and Server Setup:**
- *    - Establishes a connection to the stored Wi-Fi network.
+ *    - Connects to the stored Wi-Fi network, waiting at most `TIMEOUT_WIFI_LOADING`.
  *    - Starts the server socket to listen for client connections.
  * 3. **Firmware Update Check:**
- *    - Initializes the OTA (Over-the-Air) firmware update module.
- *    - Checks if a firmware update is available and restarts the device if necessary.
+ *    - If connected, checks if a firmware update is available and restarts the device if necessary.
  * 4. **API Initialization:**
  *    - Configures the API management module with the room number and stored credentials.
- *    - Starts the API communication with the defined server address and update parameters.
+ *    - Starts the API communication with the defined server address and update parameters, with a single attempt.
  * 5. **Sensor Initialization:**
  *    - Starts the sensor to begin collecting data.
  * 6. **Final UI Setup:**
@@ -102,15 +103,98 @@ void configurationVersion3(ServerSocketJSON &serverSocket, Screen &screen, ApiMa
  * @param sensor Reference to the Sensor object to initialize sensor readings.
  * @param screen Reference to the Screen object used to visualize the status of the configuration loading.
  * @param apiManagement Reference to the ApiManagement object to handle API communications.
- * @param wifiSSID Reference to a String object to store the retrieved Wi-Fi SSID.
- * @param wifiPassword Reference to a String object to store the retrieved Wi-Fi password.
+ * @param wifiConnection Reference to the WiFiConnection object that manages the connection.
  *
  * @warning The EEPROM must be initialized (opened) before calling this function to avoid runtime errors.
  *
  * @note The function provides real-time progress updates on the screen and manages delays to synchronize operations.
+ *  It never waits for the network longer than `TIMEOUT_WIFI_LOADING`: without Wi-Fi or backend the device works
+ *  offline, and the loop completes the work when the link comes up.
  *
- * @attention Ensure the system is connected to power and within Wi-Fi range to prevent failures during loading.
+ * @return True if the firmware update has been checked, false if the Wi-Fi was not connected in time and
+ *  `configurationLoadNetwork()` has to be called once connected.
+ */
+bool configurationLoad(FirmwareUpdateOTA firmwareUpdateOta, ServerSocketJSON &serverSocket, Sensor &sensor, Screen &screen, ApiManagement &apiManagement, WiFiConnection &wifiConnection);
+
+/**
+ * @brief Loads the system configuration without waiting for the network, so the first reading is shown in a few moments.
+ *
+ * This function is the fast version of `configurationLoad()`: the Wi-Fi association is started first and goes on
+ * while the other components are initialized, the progress is shown without keeping every message on the screen,
+ * and the firmware update check is left to `configurationLoadNetwork()`.
+ *
+ * ## Steps performed by this function:
+ * 1. **EEPROM Data Retrieval:**
+ *    - Reads Wi-Fi credentials, room ID, and API credentials from EEPROM.
+ * 2. **Wi-Fi and Server Setup:**
+ *    - Starts the connection to the stored Wi-Fi network, without waiting for it.
+ *    - Starts the server socket, which accepts clients once connected.
+ * 3. **API Setup:**
+ *    - Configures the API management module with the room number and stored credentials.
+ *    - Starts it without waiting: the room is updated and the RTC synchronized once connected.
+ * 4. **Sensor Initialization:**
+ *    - Starts the sensor to begin collecting data.
+ * 5. **Final UI Setup:**
+ *    - Updates the screen with the current room number; the status icons follow the connection later.
+ *
+ * @param serverSocket Reference to the ServerSocketJSON object for opening a server socket.
+ * @param sensor Reference to the Sensor object to initialize sensor readings.
+ * @param screen Reference to the Screen object used to visualize the status of the configuration loading.
+ * @param apiManagement Reference to the ApiManagement object to handle API communications.
+ * @param wifiConnection Reference to the WiFiConnection object that manages the connection, driven then by the loop.
+ *
+ * @warning The EEPROM must be initialized (opened) before calling this function to avoid runtime errors.
+ *
+ * @note The ApiManagement can observe the Sensor from the start: while offline, the measures are queued with the
+ *  datetime kept by the RTC.
+ *
+ * @return None (void)
+ */
+void configurationLoadFast(ServerSocketJSON &serverSocket, Sensor &sensor, Screen &screen, ApiManagement &apiManagement, WiFiConnection &wifiConnection);
+
+/**
+ * @brief Completes the loading that needs the network, once the Wi-Fi is connected: checks if a firmware update is
+ *  available and restarts the device if necessary.
+ *
+ * @param firmwareUpdateOta Reference to the FirmwareUpdateOTA object responsible for handling OTA updates.
+ * @param screen Reference to the Screen object used to show the restart after a firmware update.
+ * @param wifiConnection Reference to the WiFiConnection object that manages the connection.
+ *
+ * @note The room and the datetime are not handled here: the ApiManagement retries them once connected.
+ *
+ * @return True if done, false if the Wi-Fi is not connected yet.
+ */
+bool configurationLoadNetwork(FirmwareUpdateOTA &firmwareUpdateOta, Screen &screen, const WiFiConnection &wifiConnection);
+
+/**
+ * @brief Runs a wake of the batch mode: takes one sample, buffers it into the RTC user memory and goes back to deep sleep.
+ *
+ * This function replaces the normal boot when the batch mode is enabled, to keep the device running for the least
+ * time: no screen, no socket and no radio, except every `BATCH_WAKES_PER_UPLOAD` wakes, when the batch is uploaded.
+ *
+ * ## Steps performed by this function:
+ * 1. **Sample:**
+ *    - Loads the batch from the RTC user memory.
+ *    - Converts one sample and stores it with the datetime kept by the RTC module.
+ * 2. **Upload (only if due):**
+ *    - Reads Wi-Fi credentials, room ID, and API credentials from EEPROM.
+ *    - Connects to the stored Wi-Fi network, directed to the cached access point, waiting at most `BATCH_TIMEOUT_WIFI`.
+ *    - Uploads the batch in chunks, removing the samples uploaded.
+ * 3. **Deep Sleep:**
+ *    - Saves the batch and sleeps for `BATCH_TIME_SLEEP`, printing the time from boot to sleep.
+ *
+ * @param sleepBatch Reference to the SleepBatch object that keeps the samples across the deep sleeps.
+ * @param sensor Reference to the Sensor object to take the sample.
+ * @param datetimeInterval Reference to the DatetimeInterval object to read the datetime of the RTC module.
+ * @param apiManagement Reference to the ApiManagement object to upload the batch.
+ * @param wifiConnection Reference to the WiFiConnection object that connects for the upload.
+ *
+ * @warning The EEPROM must be initialized (opened) and configured before calling this function.
+ *
+ * @note The datetime is not synchronized with NTP, so it is as accurate as the RTC module.
+ *
+ * @attention The chip wakes up from deep sleep only if GPIO16 is wired to RST. This function never returns.
  *
  * @return None (void)
  */
-void configurationLoad(FirmwareUpdateOTA firmwareUpdateOta, ServerSocketJSON &serverSocket, Sensor &sensor, Screen &screen, ApiManagement &apiManagement, String &wifiSSID, String &wifiPassword);
\ No newline at end of file
+void configurationBatch(SleepBatch &sleepBatch, Sensor &sensor, DatetimeInterval &datetimeInterval, ApiManagement &apiManagement, WiFiConnection &wifiConnection);
@@ -2,37 +2,45 @@
 
 // ### MAIN ###
 // Versions
-const String VERSION_FIRMWARE =                                         "5.0.1";
+inline const char VERSION_FIRMWARE[] PROGMEM =                          "5.0.1";
 constexpr uint8_t VERSION_EEPROM =                                      3;
 
 // EEPROM
-constexpr uint8_t SIZE_EEPROM =                                         186;
+constexpr uint8_t SIZE_EEPROM =                                         210;
 constexpr uint8_t ADDRESS_VERSION_EEPROM =                              0;          // Size: 1
 constexpr uint8_t ADDRESS_WIFI_SSID =                                   1;          // Size: 34
 constexpr uint8_t ADDRESS_WIFI_PASSWORD =                               35;         // Size: 65
 constexpr uint8_t ADDRESS_ROOM_ID =                                     100;        // Size: 1
 constexpr uint8_t ADDRESS_CREDENTIAl_USERNAME =                         101;        // Size: 21
 constexpr uint8_t ADDRESS_CREDENTIAL_PASSWORD =                         122;        // Size: 65
+constexpr uint8_t ADDRESS_WIFI_CACHE =                                  186;        // Size: 24
 
 // Wi-Fi
 constexpr uint8_t SIZE_WIFI_SSID =                                      33;
 constexpr uint8_t SIZE_WIFI_PASSWORD =                                  64;
+constexpr uint16_t TIMEOUT_WIFI_LOADING =                               10000;      // Longest wait of the connection while loading; then it goes on in the loop.
 
 // Rooms
 constexpr uint8_t MIN_ROOM_NUMBER =                                     1;
 constexpr uint8_t MAX_ROOM_NUMBER =                                     9;
 
+// Batch
+constexpr uint32_t BATCH_TIME_SLEEP =                                   60000;      // Deep sleep between two samples.
+constexpr uint8_t BATCH_WAKES_PER_UPLOAD =                              10;         // Wakes between two uploads, the only ones with the radio on.
+constexpr uint16_t BATCH_TIMEOUT_SAMPLE =                               500;        // Longest wait of the conversion of the sensor.
+constexpr uint16_t BATCH_TIMEOUT_WIFI =                                 10000;      // Longest wait of the connection; the batch is kept for the next upload.
+
 
 
 // ### LIBRARIES ###
 // Api Management
-const String API_MANAGEMENT_BASE_ADDRESS =                              "http://airanalyzer.shadowmoses.ovh";
+inline const char API_MANAGEMENT_BASE_ADDRESS[] PROGMEM =               "http://airanalyzer.shadowmoses.ovh";
 constexpr uint16_t API_MANAGEMENT_BASE_PORT =                           80;
-constexpr uint8_t API_MANAGEMENT_MAX_ATTEMPTS =                         3;
+constexpr uint16_t API_MANAGEMENT_TIMEOUT =                             2000;       // Longest wait of a request; a failure is retried later by the loop.
 constexpr uint8_t API_MANAGEMENT_MINUTES_UPDATE_MEASURES =              10;
 
 // Firmware Update OTA
-const String FIRMWARE_UPDATE_OTA_BASE_ADDRESS =                         "http://airanalyzer.shadowmoses.ovh";
+inline const char FIRMWARE_UPDATE_OTA_BASE_ADDRESS[] PROGMEM =          "http://airanalyzer.shadowmoses.ovh";
 constexpr uint16_t FIRMWARE_UPDATE_OTA_BASE_PORT =                      80;
 
 // Screen
@@ -7,30 +7,51 @@ void resetEEPROM(uint16_t sizeEEPROM) {
     EEPROM.commit();
 }
 
-void forceConnectWiFi(const String &wifiSSID, const String &wifiPassword, uint8_t roomID) {
-    if (WiFi.status() != WL_CONNECTED) {
-        WiFi.mode(WIFI_STA);
-        WiFi.begin(wifiSSID, wifiPassword);
-        WiFi.hostname("Air Analyzer-" + String(roomID));
+void forceConnectWiFi(WiFiConnection &wifiConnection, const String &wifiSSID, const String &wifiPassword, uint8_t roomID) {
+    if (!wifiConnection.isConnected()) {
+        beginConnectWiFi(wifiConnection, wifiSSID, wifiPassword, roomID);
         Serial.print("\nConnection to WiFi..");
-        while (WiFi.status() != WL_CONNECTED) {
-            delay(500);
-            Serial.print(".");
+        while (!wifiConnection.isConnected()) {
+            wifiConnection.check();
+            delay(10);
         }
-        Serial.println("\n\tLocal IP: " + WiFi.localIP().toString());
+        saveWiFiCache(wifiConnection);
+        Serial.println("\tLocal IP: " + WiFi.localIP().toString());
         Serial.println("\tHostname: " + WiFi.hostname());
         Serial.println("\tMode: " + String(WiFi.getMode()));
     }
 }
 
+void beginConnectWiFi(WiFiConnection &wifiConnection, const String &wifiSSID, const String &wifiPassword, uint8_t roomID, uint8_t wifiDirected) {
+    WiFiConnectionCache wifiCache;
+    EEPROM.get(ADDRESS_WIFI_CACHE, wifiCache);
+
+    wifiConnection.begin(wifiSSID, wifiPassword, "Air Analyzer-" + String(roomID), &wifiCache, wifiDirected);
+}
+
+void saveWiFiCache(const WiFiConnection &wifiConnection) {
+    WiFiConnectionCache wifiCache;
+    if (!wifiConnection.getCache(wifiCache)) {
+        return;
+    }
+
+    /* Writing only if changed, to spare the flash. */
+    WiFiConnectionCache wifiCacheStored;
+    EEPROM.get(ADDRESS_WIFI_CACHE, wifiCacheStored);
+    if (memcmp(&wifiCache, &wifiCacheStored, sizeof(WiFiConnectionCache)) != 0) {
+        EEPROM.put(ADDRESS_WIFI_CACHE, wifiCache);
+        EEPROM.commit();
+    }
+}
+
 void socketRetrieveCredentials(String jsonRequestSerialized, ApiManagement &apiManagement) {
     StaticJsonDocument<512> jsonDocumentRequest;
     deserializeJson(jsonDocumentRequest, jsonRequestSerialized);
 
     char c_username[SERVER_SOCKET_SIZE_USERNAME];
     char c_password[SERVER_SOCKET_SIZE_PASSWORD];
-    static_cast<String>(jsonDocumentRequest[SERVER_SOCKET_FIELD_MESSAGE][SERVER_SOCKET_FIELD_MESSAGE_USERNAME]).toCharArray(c_username, SERVER_SOCKET_SIZE_USERNAME);
-    static_cast<String>(jsonDocumentRequest[SERVER_SOCKET_FIELD_MESSAGE][SERVER_SOCKET_FIELD_MESSAGE_PASSWORD]).toCharArray(c_password, SERVER_SOCKET_SIZE_PASSWORD);
+    static_cast<String>(jsonDocumentRequest[FPSTR(SERVER_SOCKET_FIELD_MESSAGE)][FPSTR(SERVER_SOCKET_FIELD_MESSAGE_USERNAME)]).toCharArray(c_username, SERVER_SOCKET_SIZE_USERNAME);
+    static_cast<String>(jsonDocumentRequest[FPSTR(SERVER_SOCKET_FIELD_MESSAGE)][FPSTR(SERVER_SOCKET_FIELD_MESSAGE_PASSWORD)]).toCharArray(c_password, SERVER_SOCKET_SIZE_PASSWORD);
 
     EEPROM.put(ADDRESS_CREDENTIAl_USERNAME, c_username);
     EEPROM.put(ADDRESS_CREDENTIAL_PASSWORD, c_password);
@@ -50,6 +71,75 @@ void socketSendRoomID(ServerSocketJSON &serverSocket, uint8_t roomID) {
         serverSocket.speak(jsonRequestSerialized);
     }
 }
+
+void socketSendSensorTelemetry(ServerSocketJSON &serverSocket, const Sensor &sensor, const SchedulerIdle &schedulerIdle) {
+    if (serverSocket.isAttached()) {
+        DynamicJsonDocument jsonDocumentRequest(JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(5) + JSON_ARRAY_SIZE(SENSOR_MAX_DEVICES) + SENSOR_MAX_DEVICES * (JSON_OBJECT_SIZE(9) + JSON_ARRAY_SIZE(SENSOR_TELEMETRY_HISTOGRAM_BUCKETS)));
+        const JsonArray jsonArrayDevices = jsonDocumentRequest.createNestedArray("SensorTelemetry");
+
+        for (uint8_t i = 0; i < sensor.getDevicesCount(); i++) {
+            const SensorTelemetry &telemetry = sensor.getTelemetry(i);
+
+            const JsonObject jsonObjectDevice = jsonArrayDevices.createNestedObject();
+            jsonObjectDevice["latency_last"] = telemetry.getLatencyLast();
+            jsonObjectDevice["latency_min"] = telemetry.getLatencyMin();
+            jsonObjectDevice["latency_max"] = telemetry.getLatencyMax();
+            jsonObjectDevice["samples"] = telemetry.getSamples();
+            jsonObjectDevice["samples_minute"] = telemetry.getSamplesPerMinute(millis());
+            jsonObjectDevice["failures"] = telemetry.getFailures();
+            jsonObjectDevice["rejections"] = telemetry.getRejections();
+            jsonObjectDevice["stuck"] = telemetry.isStuck();
+
+            const JsonArray jsonArrayHistogram = jsonObjectDevice.createNestedArray("latency_histogram");
+            for (uint8_t bucket = 0; bucket < SENSOR_TELEMETRY_HISTOGRAM_BUCKETS; bucket++) {
+                jsonArrayHistogram.add(telemetry.getHistogram(bucket));
+            }
+        }
+
+        const JsonObject jsonObjectPower = jsonDocumentRequest.createNestedObject("Power");
+        jsonObjectPower["sleep"] = static_cast<uint8_t>(schedulerIdle.getSleep());
+        jsonObjectPower["time_active"] = schedulerIdle.getTimeActive();
+        jsonObjectPower["time_idle"] = schedulerIdle.getTimeIdle();
+        jsonObjectPower["duty_cycle"] = schedulerIdle.getDutyCycle();
+        jsonObjectPower["energy_hour"] = schedulerIdle.getEnergyPerHour();
+
+        String jsonRequestSerialized;
+        serializeJson(jsonDocumentRequest, jsonRequestSerialized);
+
+        serverSocket.speak(jsonRequestSerialized);
+    }
+}
+
+void socketSendLoopProfile(ServerSocketJSON &serverSocket, const Profiler &profiler) {
+    if (serverSocket.isAttached()) {
+        DynamicJsonDocument jsonDocumentRequest(JSON_OBJECT_SIZE(3) + JSON_ARRAY_SIZE(PROFILER_MAX_STAGES) + PROFILER_MAX_STAGES * (JSON_OBJECT_SIZE(5) + JSON_ARRAY_SIZE(PROFILER_HISTOGRAM_BUCKETS)) + 128);
+        const JsonArray jsonArrayStages = jsonDocumentRequest.createNestedArray("LoopProfile");
+
+        for (uint8_t id = 0; id < profiler.getStagesCount(); id++) {
+            const JsonObject jsonObjectStage = jsonArrayStages.createNestedObject();
+            jsonObjectStage["name"] = FPSTR(profiler.getName(id));
+            jsonObjectStage["runs"] = profiler.getRuns(id);
+            jsonObjectStage["latency_avg"] = profiler.getLatencyAverage(id);
+            jsonObjectStage["latency_max"] = profiler.getLatencyMax(id);
+
+            const JsonArray jsonArrayHistogram = jsonObjectStage.createNestedArray("latency_histogram");
+            for (uint8_t bucket = 0; bucket < PROFILER_HISTOGRAM_BUCKETS; bucket++) {
+                jsonArrayHistogram.add(profiler.getHistogram(id, bucket));
+            }
+        }
+
+        jsonDocumentRequest["latency_worst"] = profiler.getLatencyWorst();
+        if (profiler.getStageWorst() >= 0) {
+            jsonDocumentRequest["stage_worst"] = FPSTR(profiler.getName(profiler.getStageWorst()));
+        }
+
+        String jsonRequestSerialized;
+        serializeJson(jsonDocumentRequest, jsonRequestSerialized);
+
+        serverSocket.speak(jsonRequestSerialized);
+    }
+}
+
 long calculateDelay(long timeStarted, long timeNecessary) {
     long difference = (long) (millis() - timeStarted);
     return (timeNecessary - difference) < 0 ? 0 : (timeNecessary - difference);
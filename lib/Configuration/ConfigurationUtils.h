@@ -5,9 +5,13 @@
 #include <ArduinoJson.h>
 
 #include <ApiManagement.h>
-#include <Button.h>
+#include <ButtonGesture.h>
 #include <FirmwareUpdateOTA.h>
+#include <Profiler.h>
+#include <SchedulerIdle.h>
 #include <Sensor.h>
+#include <SleepBatch.h>
+#include <WiFiConnection.h>
 #include <ServerSocketJSON.h>
 #include <Screen.h>
 
@@ -24,16 +28,42 @@
 void resetEEPROM(uint16_t sizeEEPROM);
 
 /**
- * @brief Forces a Wi-Fi connection using the provided credentials.
+ * @brief Forces a Wi-Fi connection using the provided credentials, waiting until connected.
  *
- * This function attempts to connect to a Wi-Fi network with the specified SSID and password.
- * It also generates a unique hostname based on the provided Room ID.
+ * This function starts the connection with `beginConnectWiFi()` and drives it until the link is up, storing then
+ * the cache of the connection. It is meant for the steps that cannot go on without the network, like the upgrade.
  *
+ * @param wifiConnection The WiFiConnection object that manages the connection.
  * @param wifiSSID The SSID (name) of the Wi-Fi network.
  * @param wifiPassword The password required to join the Wi-Fi network.
  * @param roomID The room ID, which is used to create a unique hostname.
+ * @warning EEPROM must be already opened before calling this function.
+ */
+void forceConnectWiFi(WiFiConnection &wifiConnection, const String &wifiSSID, const String &wifiPassword, uint8_t roomID);
+
+/**
+ * @brief Starts a Wi-Fi connection using the provided credentials, without waiting for it.
+ *
+ * The association goes on in background, driven by `wifiConnection.check()`. If a cache of the last connection is
+ * stored, the first association is directed to its access point and channel, with its lease as static IP, skipping
+ * the scan of the channels and the DHCP.
+ *
+ * @param wifiConnection The WiFiConnection object that manages the connection.
+ * @param wifiSSID The SSID (name) of the Wi-Fi network.
+ * @param wifiPassword The password required to join the Wi-Fi network.
+ * @param roomID The room ID, which is used to create a unique hostname.
+ * @param wifiDirected The associations that already used the stored lease, kept across the deep sleep in batch mode.
+ * @warning EEPROM must be already opened before calling this function.
+ */
+void beginConnectWiFi(WiFiConnection &wifiConnection, const String &wifiSSID, const String &wifiPassword, uint8_t roomID, uint8_t wifiDirected = 0);
+
+/**
+ * @brief Stores the access point and the lease of the actual connection, if changed, for the next reconnection.
+ *
+ * @param wifiConnection The WiFiConnection object that manages the connection.
+ * @warning EEPROM must be already opened before calling this function.
  */
-void forceConnectWiFi(const String &wifiSSID, const String &wifiPassword, uint8_t roomID);
+void saveWiFiCache(const WiFiConnection &wifiConnection);
 
 /**
  * @brief Stores user credentials from a JSON message into the EEPROM.
@@ -59,6 +89,32 @@ void socketRetrieveCredentials(String jsonRequestSerialized, ApiManagement &apiM
  */
 void socketSendRoomID(ServerSocketJSON &serverSocket, uint8_t roomID);
 
+/**
+ * @brief Sends the health and timing counters of every sensor device to the client via a server socket.
+ *
+ * This function serializes, for each device of the sensor, the read latency (last, min, max and histogram),
+ * the failures on the bus, the values rejected because out of range, the samples per minute and the stuck flag.
+ * It also serializes the time spent active and idle by the loop, its duty cycle and the estimated energy per hour.
+ *
+ * @param serverSocket The object representing the server socket used for communication.
+ * @param sensor The Sensor object holding the counters.
+ * @param schedulerIdle The SchedulerIdle object holding the accounting of the idle.
+ * @warning Ensure the server socket is open and the client is connected before calling this function.
+ */
+void socketSendSensorTelemetry(ServerSocketJSON &serverSocket, const Sensor &sensor, const SchedulerIdle &schedulerIdle);
+
+/**
+ * @brief Sends the timing of every stage of the loop to the client via a server socket.
+ *
+ * This function serializes, for each stage, the runs, the average and maximum latency and the histogram of the
+ * latency, together with the worst latency of the loop and the stage that caused it.
+ *
+ * @param serverSocket The object representing the server socket used for communication.
+ * @param profiler The Profiler object holding the timing.
+ * @warning Ensure the server socket is open and the client is connected before calling this function.
+ */
+void socketSendLoopProfile(ServerSocketJSON &serverSocket, const Profiler &profiler);
+
 /**
  * @brief Calculates the delay based on elapsed time and the required duration.
  * 
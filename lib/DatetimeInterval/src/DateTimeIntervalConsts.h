@@ -1,5 +1,5 @@
 #ifndef DATETIMEINTERVALCONSTS_H
     #define DATETIMEINTERVALCONSTS_H
     constexpr uint8_t DATE_INTERVAL_TIMEOUT_RTC_CHECK_DAY =                     14;
-    constexpr uint16_t DATE_INTERVAL_TIMEOUT_NTP_CHECK_MILLISECONDS =           5000; // Timeout to check the datetime from NTP.
+    constexpr uint8_t DATE_INTERVAL_TIMEOUT_NTP_RETRY_MINUTES =                 5;    // Delay before retrying a failed synchronization with NTP.
 #endif // DATETIMEINTERVALCONSTS_H
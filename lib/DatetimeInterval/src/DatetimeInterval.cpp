@@ -13,8 +13,12 @@ void DatetimeInterval::begin(uint8_t totalMinuteUpdate) {
 
     /* Calculating the datetime for next update about RTC. */
     timespanDatetimeRTC = TimeSpan(DATE_INTERVAL_TIMEOUT_RTC_CHECK_DAY, 0, 0, 0);
-    updateDatetimeRTC();
-    configNextDatetimeRTC();
+    if (updateDatetimeRTC()) {
+        configNextDatetimeRTC();
+    } else {
+        /* Retrying at the next check, keeping the datetime of the RTC meanwhile. */
+        nextDatetimeRTC = DateTime(rtc.now());
+    }
 
     /* Calculating the datetime for next update. */
     const uint8_t updateHour = totalMinuteUpdate / 60;
@@ -23,14 +27,24 @@ void DatetimeInterval::begin(uint8_t totalMinuteUpdate) {
     configNextDatetime();
 }
 
-bool DatetimeInterval::checkDatetime() {
+void DatetimeInterval::beginOffline() { rtc.begin(); }
+
+uint32_t DatetimeInterval::getActualEpoch() { return DateTime(rtc.now()).unixtime(); }
+
+bool DatetimeInterval::checkDatetime() { return DateTime(rtc.now()) > nextDatetime; }
+
+bool DatetimeInterval::syncDatetime() {
     /* Checking the datetime of RTC for updating if is necessary. */
-    if (checkDatetimeRTC()) {
-        updateDatetimeRTC();
-        configNextDatetimeRTC();
+    if (checkDatetimeRTC() && isLinkUp) {
+        if (updateDatetimeRTC()) {
+            configNextDatetimeRTC();
+            return true;
+        }
+
+        nextDatetimeRTC = DateTime(rtc.now() + TimeSpan(0, 0, DATE_INTERVAL_TIMEOUT_NTP_RETRY_MINUTES, 0));
     }
 
-    return DateTime(rtc.now()) > nextDatetime;
+    return false;
 }
 
 uint16_t DatetimeInterval::getActualYear() { return DateTime(rtc.now()).year(); }
@@ -60,10 +74,12 @@ struct tm DatetimeInterval::getTmDatetime(const DateTime &datetime) {
     return actualDatetime_tm;
 }
 
-String DatetimeInterval::getActualTimestamp() {
+String DatetimeInterval::getActualTimestamp() { return getTimestamp(DateTime(rtc.now()).unixtime()); }
+
+String DatetimeInterval::getTimestamp(uint32_t epoch) {
     char timestamp[26];
 
-    const DateTime actualDatetime = DateTime(rtc.now());
+    const DateTime actualDatetime = DateTime(epoch);
     const struct tm actualDatetime_tm = getTmDatetime(actualDatetime);
 
     sprintf(
@@ -80,6 +96,8 @@ String DatetimeInterval::getActualTimestamp() {
     return {timestamp};
 }
 
+void DatetimeInterval::updateLink(bool isConnected) { isLinkUp = isConnected; }
+
 void DatetimeInterval::configNextDatetime() {
     const String daysOfTheWeek[7] = {"SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
 
@@ -108,17 +126,19 @@ void DatetimeInterval::configNextDatetimeRTC() {
     nextDatetimeRTC = DateTime(rtc.now() + timespanDatetimeRTC);
 }
 
-void DatetimeInterval::updateDatetimeRTC() {
-    /* Connecting to NTP server to get the actual datetime. */
-    while (WiFi.status() != WL_CONNECTED) {
-        delay(500);
+bool DatetimeInterval::updateDatetimeRTC() {
+    if (!isLinkUp) {
+        Serial.println("\033[1;91m[NTP ERROR: WI-FI NOT CONNECTED, RTC KEPT]\033[0m");
+        return false;
     }
+
+    /* Connecting to NTP server to get the actual datetime. */
     ntpClient.begin();
-    while (!ntpClient.update()) {
-        yield();
+    if (!ntpClient.update()) {
+        ntpClient.end();
 
-        Serial.println("\033[1;91m[NTP ERROR]\033[0m");
-        delay(DATE_INTERVAL_TIMEOUT_NTP_CHECK_MILLISECONDS);
+        Serial.println("\033[1;91m[NTP ERROR: RTC KEPT]\033[0m");
+        return false;
     }
 
     /* Updating the RTC. */
@@ -126,4 +146,6 @@ void DatetimeInterval::updateDatetimeRTC() {
     Serial.println("\033[1;92m[RTC UPDATED]\033[0m");
 
     ntpClient.end();
+
+    return true;
 }
\ No newline at end of file
@@ -11,8 +11,8 @@
  * @author Davide Palladino
  * @contact davidepalladino@hotmail.com
  * @website https://davidepalladino.github.io/
- * @version 5.0.0
- * @date 29th January 2025
+ * @version 5.4.0
+ * @date 18th October 2026
  */
 
 #ifndef DATETIMEINTERVAL_H
@@ -23,6 +23,7 @@
     #include <NTPClient.h>
     #include <RTClib.h>
     #include <Wire.h>
+    #include <WiFiConnectionObserver.h>
 
     #include <DateTimeIntervalConsts.h>
 
@@ -31,9 +32,10 @@
     * @brief Manages time intervals using an RTC module and NTP synchronization.
     *
     * This class provides functionality to synchronize time using an NTP server and an RTC module,
-    * allowing periodic updates based on configurable time intervals.
+    * allowing periodic updates based on configurable time intervals. The NTP server is queried only while the link
+    * notified by WiFiConnection is up.
     */
-    class DatetimeInterval {
+    class DatetimeInterval : public WiFiConnectionObserver {
         public:
             /**
              * @brief Constructs a DatetimeInterval object with NTP client settings.
@@ -45,15 +47,37 @@
              * @brief Initializes the RTC object and sets the next update time.
              * @param totalMinuteUpdate Total minutes between updates (max: 240 minutes).
              * @warning Values above 240 minutes will be capped.
+             * @note It does not wait for the network: if the RTC cannot be synchronized now, `syncDatetime()` retries
+             *  while the datetime kept by the RTC is used.
              */
             void begin(uint8_t totalMinuteUpdate);
 
+            /**
+             * @brief Initializes only the RTC object, to read the datetime it keeps without any network.
+             * @note The scheduled updates are not configured, so `checkDatetime()` must not be used.
+             */
+            void beginOffline();
+
+            /**
+             * @brief Retrieves the current datetime from the RTC module as Unix time.
+             * @return The seconds since 1st January 1970.
+             */
+            uint32_t getActualEpoch();
+
             /**
              * @brief Checks if the actual datetime exceeds the next scheduled update.
              * @return True if the update interval has elapsed, false otherwise.
+             * @note It only reads the RTC, so it can be called while handling every measure.
              */
             bool checkDatetime();
 
+            /**
+             * @brief Synchronizes the RTC with the NTP server, if its interval has elapsed and the link is up.
+             * @return True if the RTC has been updated now, false otherwise.
+             * @note It waits for the NTP server, so call it with the other requests to the network, not on every measure.
+             */
+            bool syncDatetime();
+
             /**
              * @brief Configures the next scheduled datetime based on the update interval.
              */
@@ -114,6 +138,19 @@
              */
             String getActualTimestamp();
 
+            /**
+             * @brief Formats a datetime as timestamp.
+             * @param epoch The datetime as Unix time.
+             * @return A string representing the timestamp in format "YYYY-MM-DD HH:MM:SS".
+             */
+            String getTimestamp(uint32_t epoch);
+
+            /**
+             * @brief Updates the state of the link, so the NTP server is queried only while it is up.
+             * @param isConnected True if the link is up, false otherwise.
+             */
+            void updateLink(bool isConnected) override;
+
         private:
             NTPClient ntpClient;             /**< NTP client for time synchronization. */
             TimeSpan timespanDatetime;       /**< Timespan for next scheduled update. */
@@ -121,6 +158,7 @@
             RTC_DS3231 rtc;                  /**< RTC module instance. */
             TimeSpan timespanDatetimeRTC;    /**< RTC-based timespan for updates. */
             DateTime nextDatetimeRTC;        /**< Next RTC-based update time. */
+            bool isLinkUp = false;           /**< Indicates whether the link notified by WiFiConnection is up. */
 
             /**
              * @brief Checks if the current RTC datetime exceeds the next scheduled update.
@@ -134,9 +172,10 @@
             void configNextDatetimeRTC();
 
             /**
-             * @brief Updates the RTC module with the latest synchronized time.
+             * @brief Updates the RTC module with the latest synchronized time, with a single attempt.
+             * @return True if the RTC has been updated, false if the link is down or the NTP server does not respond.
              */
-            void updateDatetimeRTC();
+            bool updateDatetimeRTC();
     };
 
 #endif // DATETIMEINTERVAL_H
\ No newline at end of file
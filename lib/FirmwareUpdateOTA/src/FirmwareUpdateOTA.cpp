@@ -12,7 +12,7 @@ void FirmwareUpdateOTA::begin(const String &address, uint16_t port) {
 }
 
 bool FirmwareUpdateOTA::check(const String &version) {
-    switch (ESPhttpUpdate.update(wifiClient, serverAddress + ":" + String(serverPort) + "/" + FIRMWARE_UPDATE_OTA_URI_GET_LATEST, version)) {
+    switch (ESPhttpUpdate.update(wifiClient, serverAddress + ":" + String(serverPort) + "/" + FPSTR(FIRMWARE_UPDATE_OTA_URI_GET_LATEST), version)) {
         case HTTP_UPDATE_OK:
             Serial.println("\033[1;92m[FIRMWARE UPDATED]\033[0m");
             return true;
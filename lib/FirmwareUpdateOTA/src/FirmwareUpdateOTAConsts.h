@@ -1,4 +1,4 @@
 #ifndef FIRMWAREUPDATEOTACONSTS_H
     #define FIRMWAREUPDATEOTACONSTS_H
-    const String FIRMWARE_UPDATE_OTA_URI_GET_LATEST = "api/firmware/getLatest";
+    inline const char FIRMWARE_UPDATE_OTA_URI_GET_LATEST[] PROGMEM = "api/firmware/getLatest";
 #endif // FIRMWAREUPDATEOTACONSTS_H
@@ -0,0 +1,99 @@
+#include "Profiler.h"
+
+Profiler::Profiler() : count(0) { reset(); }
+
+int8_t Profiler::addStage(PGM_P name) {
+    if (count >= PROFILER_MAX_STAGES) {
+        Serial.println("\033[1;91m[PROFILER ERROR: STAGE NOT ADDED]\033[0m");
+        return -1;
+    }
+
+    names[count] = name;
+
+    return count++;
+}
+
+uint32_t Profiler::start() { return ESP.getCycleCount(); }
+
+void Profiler::record(int8_t id, uint32_t cyclesStart) {
+    /* Unsigned subtraction keeps the duration right across the overflow of the counter. */
+    const uint32_t latency = (ESP.getCycleCount() - cyclesStart) / ESP.getCpuFreqMHz();
+    if (id < 0 || id >= count) {
+        return;
+    }
+
+    runs[id]++;
+    latencyTotal[id] += latency;
+    if (latency > latencyMax[id]) {
+        latencyMax[id] = latency;
+    }
+    if (stageWorst < 0 || latency > latencyWorst) {
+        latencyWorst = latency;
+        stageWorst = id;
+    }
+
+    /* Finding the bucket by doubling the upper limit, at most "PROFILER_HISTOGRAM_BUCKETS" steps. */
+    uint8_t bucket = 0;
+    uint32_t limit = PROFILER_HISTOGRAM_FIRST;
+    while (latency >= limit && bucket < PROFILER_HISTOGRAM_BUCKETS - 1) {
+        limit <<= 1;
+        bucket++;
+    }
+    histograms[id][bucket]++;
+}
+
+void Profiler::reset() {
+    for (uint8_t id = 0; id < PROFILER_MAX_STAGES; id++) {
+        runs[id] = 0;
+        latencyTotal[id] = 0;
+        latencyMax[id] = 0;
+        for (uint32_t &bucket : histograms[id]) {
+            bucket = 0;
+        }
+    }
+
+    latencyWorst = 0;
+    stageWorst = -1;
+}
+
+uint8_t Profiler::getStagesCount() const { return count; }
+
+PGM_P Profiler::getName(uint8_t id) const { return id < count ? names[id] : nullptr; }
+
+uint32_t Profiler::getRuns(uint8_t id) const { return id < count ? runs[id] : 0; }
+
+uint32_t Profiler::getLatencyAverage(uint8_t id) const { return (id < count && runs[id] > 0) ? static_cast<uint32_t>(latencyTotal[id] / runs[id]) : 0; }
+
+uint32_t Profiler::getLatencyMax(uint8_t id) const { return id < count ? latencyMax[id] : 0; }
+
+uint32_t Profiler::getHistogram(uint8_t id, uint8_t bucket) const { return (id < count && bucket < PROFILER_HISTOGRAM_BUCKETS) ? histograms[id][bucket] : 0; }
+
+uint32_t Profiler::getLatencyWorst() const { return latencyWorst; }
+
+int8_t Profiler::getStageWorst() const { return stageWorst; }
+
+void Profiler::print(Print &output) const {
+    for (uint8_t id = 0; id < count; id++) {
+        output.print(F("[PROFILER] "));
+        output.print(FPSTR(names[id]));
+        output.print(F(": runs "));
+        output.print(runs[id]);
+        output.print(F(", avg "));
+        output.print(getLatencyAverage(id));
+        output.print(F(" us, max "));
+        output.print(latencyMax[id]);
+        output.print(F(" us, histogram"));
+        for (uint8_t bucket = 0; bucket < PROFILER_HISTOGRAM_BUCKETS; bucket++) {
+            output.print(' ');
+            output.print(histograms[id][bucket]);
+        }
+        output.println();
+    }
+
+    if (stageWorst >= 0) {
+        output.print(F("[PROFILER] Worst: "));
+        output.print(latencyWorst);
+        output.print(F(" us, by "));
+        output.println(FPSTR(names[stageWorst]));
+    }
+}
@@ -0,0 +1,156 @@
+/**
+ * @file Profiler.h
+ * @brief Provides the timing of the stages of the loop, to find which one causes jitter and freezes.
+ *
+ * Every stage is timed with the cycle counter of the CPU, read with a single instruction, and recorded with a
+ * handful of integer operations into its own histogram, so the profiler can stay enabled in production. The worst
+ * latency of the whole loop is kept together with the stage that caused it.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef PROFILER_H
+    #define PROFILER_H
+
+    #include <Arduino.h>
+
+    #include "ProfilerConsts.h"
+
+    /**
+     * @class Profiler
+     * @brief Records the latency of up to `PROFILER_MAX_STAGES` stages into histograms.
+     */
+    class Profiler {
+        public:
+            Profiler();
+
+            /**
+             * @brief Adds a stage.
+             *
+             * @param name The name of the stage, stored in flash.
+             * @return The identifier of the stage, -1 if the profiler is full.
+             */
+            int8_t addStage(PGM_P name);
+
+            /**
+             * @brief Gets the actual value of the cycle counter, to pass to "record()" at the end of the stage.
+             *
+             * @return The cycles since boot, modulo 2^32.
+             */
+            static uint32_t start();
+
+            /**
+             * @brief Records the run of a stage.
+             *
+             * @param id The identifier of the stage.
+             * @param cyclesStart The value returned by "start()" at the beginning of the stage; runs up to 2^32 cycles are measured right.
+             */
+            void record(int8_t id, uint32_t cyclesStart);
+
+            /** @brief Clears the counters of every stage, keeping the stages. */
+            void reset();
+
+            /**
+             * @brief Gets the number of stages added.
+             *
+             * @return The number of stages.
+             */
+            uint8_t getStagesCount() const;
+
+            /**
+             * @brief Gets the name of a stage.
+             *
+             * @param id The identifier of the stage.
+             * @return The name, stored in flash.
+             */
+            PGM_P getName(uint8_t id) const;
+
+            /**
+             * @brief Gets the number of runs of a stage.
+             *
+             * @param id The identifier of the stage.
+             * @return The number of runs.
+             */
+            uint32_t getRuns(uint8_t id) const;
+
+            /**
+             * @brief Gets the average latency of a stage.
+             *
+             * @param id The identifier of the stage.
+             * @return The latency in microseconds, 0 if never run.
+             */
+            uint32_t getLatencyAverage(uint8_t id) const;
+
+            /**
+             * @brief Gets the maximum latency of a stage.
+             *
+             * @param id The identifier of the stage.
+             * @return The latency in microseconds.
+             */
+            uint32_t getLatencyMax(uint8_t id) const;
+
+            /**
+             * @brief Gets a bucket of the histogram of the latency of a stage.
+             *
+             * @param id The identifier of the stage.
+             * @param bucket The bucket, whose upper limit is `PROFILER_HISTOGRAM_FIRST` doubled `bucket` times; the last has no limit.
+             * @return The number of runs into the bucket.
+             */
+            uint32_t getHistogram(uint8_t id, uint8_t bucket) const;
+
+            /**
+             * @brief Gets the worst latency of any stage.
+             *
+             * @return The latency in microseconds.
+             */
+            uint32_t getLatencyWorst() const;
+
+            /**
+             * @brief Gets the stage of the worst latency.
+             *
+             * @return The identifier of the stage, -1 if no stage has been run.
+             */
+            int8_t getStageWorst() const;
+
+            /**
+             * @brief Prints a summary of every stage, one per line.
+             *
+             * @param output The destination of the summary (e.g., Serial).
+             */
+            void print(Print &output) const;
+
+        private:
+            PGM_P names[PROFILER_MAX_STAGES];                                           /**< Names of the stages, stored in flash. */
+            uint32_t runs[PROFILER_MAX_STAGES];                                         /**< Runs of the stages. */
+            uint64_t latencyTotal[PROFILER_MAX_STAGES];                                 /**< Sum of the latencies, in microseconds. */
+            uint32_t latencyMax[PROFILER_MAX_STAGES];                                   /**< Maximum latencies, in microseconds. */
+            uint32_t histograms[PROFILER_MAX_STAGES][PROFILER_HISTOGRAM_BUCKETS];       /**< Histograms of the latencies. */
+            uint8_t count;                                                              /**< Number of stages added. */
+            uint32_t latencyWorst;                                                      /**< Worst latency of any stage, in microseconds. */
+            int8_t stageWorst;                                                          /**< Stage of the worst latency. */
+    };
+
+    /**
+     * @class ProfilerScope
+     * @brief Records a stage of a Profiler from its construction to the end of its scope.
+     */
+    class ProfilerScope {
+        public:
+            ProfilerScope(Profiler &profiler, int8_t id) : profiler(profiler), id(id), cyclesStart(Profiler::start()) { }
+
+            ~ProfilerScope() { profiler.record(id, cyclesStart); }
+
+        private:
+            Profiler &profiler;
+            const int8_t id;
+            const uint32_t cyclesStart;
+    };
+
+#endif // PROFILER_H
@@ -0,0 +1,6 @@
+#ifndef PROFILERCONSTS_H
+    #define PROFILERCONSTS_H
+    constexpr uint8_t PROFILER_MAX_STAGES = 10;                 // Capacity of the profiler, allocated inline.
+    constexpr uint8_t PROFILER_HISTOGRAM_BUCKETS = 12;
+    constexpr uint32_t PROFILER_HISTOGRAM_FIRST = 64;           // Microseconds, upper limit of the first bucket; every next one doubles.
+#endif // PROFILERCONSTS_H
@@ -0,0 +1,132 @@
+#include "Scheduler.h"
+
+Scheduler::Scheduler() : count(0), size(0) { }
+
+int8_t Scheduler::add(SchedulerTask task, uint32_t interval) {
+    if (count >= SCHEDULER_MAX_TASKS || task == nullptr) {
+        Serial.println("\033[1;91m[SCHEDULER ERROR: TASK NOT ADDED]\033[0m");
+        return -1;
+    }
+
+    tasks[count] = task;
+    intervals[count] = interval;
+    deadlines[count] = 0;
+    positions[count] = SCHEDULER_NOT_SCHEDULED;
+
+    return count++;
+}
+
+void Scheduler::schedule(int8_t id, uint32_t delay) {
+    if (id < 0 || id >= count) {
+        return;
+    }
+
+    cancel(id);
+    deadlines[id] = millis() + delay;
+    push(id);
+}
+
+void Scheduler::cancel(int8_t id) {
+    if (isScheduled(id)) {
+        removeAt(positions[id]);
+    }
+}
+
+bool Scheduler::isScheduled(int8_t id) const { return id >= 0 && id < count && positions[id] != SCHEDULER_NOT_SCHEDULED; }
+
+uint8_t Scheduler::run() {
+    const uint32_t now = millis();
+    uint8_t executed = 0;
+
+    /* The limit stops a task that schedules itself with no delay from keeping the loop here. */
+    while (size > 0 && !isBefore(now, deadlines[heap[0]]) && executed < SCHEDULER_MAX_TASKS) {
+        const uint8_t id = heap[0];
+        removeAt(0);
+
+        if (intervals[id] > 0) {
+            deadlines[id] += intervals[id];
+            if (isBefore(deadlines[id], now)) {
+                deadlines[id] = now + intervals[id];
+            }
+            push(id);
+        }
+
+        tasks[id]();
+        executed++;
+    }
+
+    return executed;
+}
+
+uint32_t Scheduler::getTimeToNextDeadline() const {
+    if (size == 0) {
+        return SCHEDULER_NO_DEADLINE;
+    }
+
+    const int32_t remaining = static_cast<int32_t>(deadlines[heap[0]] - millis());
+    return (remaining > 0) ? static_cast<uint32_t>(remaining) : 0;
+}
+
+bool Scheduler::isBefore(uint32_t first, uint32_t second) { return static_cast<int32_t>(first - second) < 0; }
+
+void Scheduler::push(uint8_t id) {
+    place(size, id);
+    siftUp(size++);
+}
+
+void Scheduler::removeAt(uint8_t position) {
+    positions[heap[position]] = SCHEDULER_NOT_SCHEDULED;
+
+    size--;
+    if (position == size) {
+        return;
+    }
+
+    /* The last task fills the hole, then moves up or down to its place. */
+    const uint8_t id = heap[size];
+    place(position, id);
+    siftUp(position);
+    siftDown(positions[id]);
+}
+
+void Scheduler::siftUp(uint8_t position) {
+    while (position > 0) {
+        const uint8_t parent = (position - 1) / 2;
+        if (!isBefore(deadlines[heap[position]], deadlines[heap[parent]])) {
+            break;
+        }
+
+        const uint8_t id = heap[position];
+        place(position, heap[parent]);
+        place(parent, id);
+        position = parent;
+    }
+}
+
+void Scheduler::siftDown(uint8_t position) {
+    while (true) {
+        const uint8_t left = 2 * position + 1;
+        const uint8_t right = left + 1;
+        uint8_t nearest = position;
+
+        if (left < size && isBefore(deadlines[heap[left]], deadlines[heap[nearest]])) {
+            nearest = left;
+        }
+        if (right < size && isBefore(deadlines[heap[right]], deadlines[heap[nearest]])) {
+            nearest = right;
+        }
+        if (nearest == position) {
+            break;
+        }
+
+        const uint8_t id = heap[position];
+        place(position, heap[nearest]);
+        place(nearest, id);
+        position = nearest;
+    }
+}
+
+void Scheduler::place(uint8_t position, uint8_t id) {
+    heap[position] = id;
+    positions[id] = position;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file Scheduler.h
+ * @brief Provides a cooperative scheduler of periodic and one-shot tasks, ordered by deadline.
+ *
+ * The deadlines are kept in a binary min-heap, so the loop checks only the nearest one and runs only the tasks that
+ * are due, instead of polling every subsystem on every pass. The deadlines are compared through their signed
+ * difference, so the order stays right across the overflow of `millis()`.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef SCHEDULER_H
+    #define SCHEDULER_H
+
+    #include <Arduino.h>
+
+    #include "SchedulerConsts.h"
+
+    /**
+     * @brief Pointer type to the function of a task.
+     */
+    typedef void (*SchedulerTask)();
+
+    /**
+     * @class Scheduler
+     * @brief Runs up to `SCHEDULER_MAX_TASKS` tasks at their deadlines.
+     */
+    class Scheduler {
+        public:
+            Scheduler();
+
+            /**
+             * @brief Adds a task, not scheduled yet.
+             *
+             * @param task The function of the task.
+             * @param interval Time in milliseconds between two runs of a periodic task, 0 for a one-shot task.
+             * @return The identifier of the task, -1 if the scheduler is full.
+             */
+            int8_t add(SchedulerTask task, uint32_t interval = 0);
+
+            /**
+             * @brief Schedules a task, moving its deadline if it is already scheduled.
+             *
+             * @param id The identifier of the task.
+             * @param delay Time in milliseconds from now to the run.
+             */
+            void schedule(int8_t id, uint32_t delay);
+
+            /**
+             * @brief Removes a task from the schedule, keeping it added.
+             *
+             * @param id The identifier of the task.
+             */
+            void cancel(int8_t id);
+
+            /**
+             * @brief Checks if a task is scheduled.
+             *
+             * @param id The identifier of the task.
+             * @return True if scheduled, false otherwise.
+             */
+            bool isScheduled(int8_t id) const;
+
+            /**
+             * @brief Runs the tasks whose deadline is elapsed, in order of deadline.
+             *
+             * A periodic task is scheduled again before it runs, so it can cancel or move itself. If it has been
+             *  delayed by more than its interval, the lost runs are skipped instead of being run in a burst.
+             *
+             * @return The number of tasks run.
+             */
+            uint8_t run();
+
+            /**
+             * @brief Gets the time to the nearest deadline, for the loop to know how long nothing has to run.
+             *
+             * @return The time in milliseconds, 0 if a task is due, `SCHEDULER_NO_DEADLINE` if no task is scheduled.
+             */
+            uint32_t getTimeToNextDeadline() const;
+
+        private:
+            SchedulerTask tasks[SCHEDULER_MAX_TASKS];               /**< Functions of the tasks. */
+            uint32_t intervals[SCHEDULER_MAX_TASKS];                /**< Intervals of the tasks, 0 if one-shot. */
+            uint32_t deadlines[SCHEDULER_MAX_TASKS];                /**< Deadlines of the tasks, in milliseconds. */
+            uint8_t positions[SCHEDULER_MAX_TASKS];                 /**< Positions of the tasks into the heap. */
+            uint8_t heap[SCHEDULER_MAX_TASKS];                      /**< Identifiers of the scheduled tasks, nearest deadline first. */
+            uint8_t count;                                          /**< Number of tasks added. */
+            uint8_t size;                                           /**< Number of tasks scheduled. */
+
+            static bool isBefore(uint32_t first, uint32_t second);
+
+            void push(uint8_t id);
+            void removeAt(uint8_t position);
+            void siftUp(uint8_t position);
+            void siftDown(uint8_t position);
+            void place(uint8_t position, uint8_t id);
+    };
+
+#endif // SCHEDULER_H
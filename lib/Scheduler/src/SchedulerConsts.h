@@ -0,0 +1,11 @@
+#ifndef SCHEDULERCONSTS_H
+    #define SCHEDULERCONSTS_H
+    constexpr uint8_t SCHEDULER_MAX_TASKS = 9;                  // Capacity of the scheduler, allocated inline.
+    constexpr uint8_t SCHEDULER_NOT_SCHEDULED = 0xFF;           // Position in the heap of a task not scheduled.
+    constexpr uint32_t SCHEDULER_NO_DEADLINE = UINT32_MAX;      // Time to the next deadline when no task is scheduled.
+
+    // Estimation of the energy, from the datasheet of ESP8266EX with the station connected.
+    constexpr uint16_t SCHEDULER_SUPPLY_VOLTAGE =               3300;       // Millivolts.
+    constexpr uint32_t SCHEDULER_CURRENT_ACTIVE =               70000;      // Microamperes, CPU and radio on.
+    constexpr uint32_t SCHEDULER_CURRENT_IDLE[3] =              {70000, 15000, 900};     // Microamperes while idle, in order of "schedulerSleep_t".
+#endif // SCHEDULERCONSTS_H
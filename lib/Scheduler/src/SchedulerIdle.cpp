@@ -0,0 +1,62 @@
+#include "SchedulerIdle.h"
+
+SchedulerIdle::SchedulerIdle(Scheduler &scheduler) : scheduler(scheduler), sleep(SCHEDULER_SLEEP_NONE), microsActive(0), microsIdle(0), lastWake(0) { }
+
+void SchedulerIdle::begin(schedulerSleep_t sleep) {
+    this->sleep = sleep;
+
+    switch (sleep) {
+        case SCHEDULER_SLEEP_MODEM:
+            WiFi.setSleepMode(WIFI_MODEM_SLEEP);
+            break;
+
+        case SCHEDULER_SLEEP_LIGHT:
+            WiFi.setSleepMode(WIFI_LIGHT_SLEEP);
+            break;
+
+        default:
+            WiFi.setSleepMode(WIFI_NONE_SLEEP);
+            break;
+    }
+
+    microsActive = 0;
+    microsIdle = 0;
+    lastWake = micros();
+}
+
+void SchedulerIdle::idle(uint32_t maximum) {
+    const unsigned long start = micros();
+    microsActive += start - lastWake;
+
+    /* The SDK sleeps only inside "delay()", so waiting there is what lets the chip sleep. */
+    const uint32_t timeIdle = min(scheduler.getTimeToNextDeadline(), maximum);
+    if (timeIdle > 0) {
+        delay(timeIdle);
+    }
+
+    lastWake = micros();
+    microsIdle += lastWake - start;
+}
+
+schedulerSleep_t SchedulerIdle::getSleep() const { return sleep; }
+
+uint32_t SchedulerIdle::getTimeActive() const { return static_cast<uint32_t>(microsActive / 1000); }
+
+uint32_t SchedulerIdle::getTimeIdle() const { return static_cast<uint32_t>(microsIdle / 1000); }
+
+uint16_t SchedulerIdle::getDutyCycle() const {
+    const uint64_t total = microsActive + microsIdle;
+    if (total == 0) {
+        return 1000;
+    }
+
+    return static_cast<uint16_t>((microsActive * 1000) / total);
+}
+
+uint32_t SchedulerIdle::getEnergyPerHour() const {
+    const uint16_t dutyCycle = getDutyCycle();
+    const uint32_t currentAverage = (dutyCycle * SCHEDULER_CURRENT_ACTIVE + (1000 - dutyCycle) * SCHEDULER_CURRENT_IDLE[sleep]) / 1000;
+
+    /* Millivolts by microamperes are nanowatts; over an hour, nanowatt hours. */
+    return static_cast<uint32_t>((static_cast<uint64_t>(currentAverage) * SCHEDULER_SUPPLY_VOLTAGE) / 1000000);
+}
@@ -0,0 +1,108 @@
+/**
+ * @file SchedulerIdle.h
+ * @brief Provides the idle of the loop until the next deadline of the Scheduler, letting the chip sleep meanwhile.
+ *
+ * With a sleep mode enabled, the SDK of ESP8266 turns the radio off (modem sleep) or also suspends the CPU (light
+ * sleep) while the loop waits in `delay()`, waking up on the timer and at every beacon of the access point, so the
+ * station stays connected and the socket keeps accepting clients. The time spent active and idle is accounted, to
+ * report the duty cycle and an estimation of the energy used per hour.
+ * In light sleep the GPIO interrupts are served only at the next wake, up to a beacon interval later, so the edges of
+ * a button get late timestamps; the wake-up on GPIO of the SDK would fix it, but it turns the interrupt of the pin
+ * into a level one, breaking the edges. The modem sleep keeps the CPU on and is the choice with a button.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.1
+ * @date 18th October 2026
+ */
+
+#ifndef SCHEDULERIDLE_H
+    #define SCHEDULERIDLE_H
+
+    #include <Arduino.h>
+    #include <ESP8266WiFi.h>
+
+    #include "SchedulerConsts.h"
+    #include "Scheduler.h"
+
+    typedef enum schedulerSleep : uint8_t {SCHEDULER_SLEEP_NONE, SCHEDULER_SLEEP_MODEM, SCHEDULER_SLEEP_LIGHT} schedulerSleep_t;
+
+    /**
+     * @class SchedulerIdle
+     * @brief Waits, at the end of every loop, until the next deadline of a Scheduler.
+     */
+    class SchedulerIdle {
+        public:
+            /**
+             * @brief Constructs a SchedulerIdle object.
+             *
+             * @param scheduler The scheduler whose deadlines end the idle.
+             */
+            explicit SchedulerIdle(Scheduler &scheduler);
+
+            /**
+             * @brief Sets the sleep mode of the chip while idle, and starts the accounting.
+             *
+             * @param sleep The sleep mode; the light sleep saves the most, but delays the interrupts to the next wake;
+             *  the modem sleep keeps the CPU running.
+             */
+            void begin(schedulerSleep_t sleep);
+
+            /**
+             * @brief Waits until the next deadline, for at most the given time.
+             *
+             * The maximum bounds the latency of the work polled by the loop, like the socket; the edges of the button
+             *  are taken by its interrupt, so they keep their time unless the chip is in light sleep.
+             *
+             * @param maximum The maximum time in milliseconds.
+             */
+            void idle(uint32_t maximum);
+
+            /**
+             * @brief Gets the sleep mode set.
+             *
+             * @return The sleep mode.
+             */
+            schedulerSleep_t getSleep() const;
+
+            /**
+             * @brief Gets the time spent running the loop since "begin()".
+             *
+             * @return The time in milliseconds.
+             */
+            uint32_t getTimeActive() const;
+
+            /**
+             * @brief Gets the time spent idle since "begin()".
+             *
+             * @return The time in milliseconds.
+             */
+            uint32_t getTimeIdle() const;
+
+            /**
+             * @brief Gets the share of the time spent running the loop.
+             *
+             * @return The duty cycle in thousandths, 1000 if nothing has been accounted yet.
+             */
+            uint16_t getDutyCycle() const;
+
+            /**
+             * @brief Gets the energy used per hour with the actual duty cycle, estimated from the currents of the datasheet.
+             *
+             * @return The energy in milliwatt hours.
+             */
+            uint32_t getEnergyPerHour() const;
+
+        private:
+            Scheduler &scheduler;                                   /**< Scheduler whose deadlines end the idle. */
+            schedulerSleep_t sleep;                                 /**< Sleep mode of the chip while idle. */
+            uint64_t microsActive;                                  /**< Time in microseconds spent running the loop. */
+            uint64_t microsIdle;                                    /**< Time in microseconds spent idle. */
+            unsigned long lastWake;                                 /**< Time in microseconds of the end of the last idle. */
+    };
+
+#endif // SCHEDULERIDLE_H
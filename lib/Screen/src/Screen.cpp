@@ -1,128 +1,392 @@
 #include <Screen.h>
 
-Screen::Screen(uint8_t pinSCL, uint8_t pinSDA) {
-    screen = new U8G2_SSD1306_128X32_UNIVISION_F_HW_I2C (U8G2_R0, pinSCL, pinSDA);
+const Screen::ptrDraw Screen::drawListMainPage[SCREEN_WIDGET_COUNT] = {
+    &Screen::drawRoomID,
+    &Screen::drawTemperature,
+    &Screen::drawHumidity,
+    &Screen::drawWiFiStatus,
+    &Screen::drawUpdateStatus
+};
+
+Screen::Screen(uint8_t pinSCL, uint8_t pinSDA) : Screen(new ScreenDisplay(U8G2_R0, pinSCL, pinSDA)) { }
+
+Screen::Screen(U8G2 *display) {
+    screen = display;
 
     roomNumber = 0;
 
     connectionState = true;
     updateState = false;
 
+    temperatureTenths = 0;
+    humidityTenths = 0;
     areValuesEmpty = true;
+
+    currentPage = SCREEN_PAGE_NONE;
+    requestedPage = SCREEN_PAGE_NONE;
+    dirtyStates = SCREEN_STATE_MAIN_PAGE;
+    widgetsRedrawn = 0;
+    historyDrawn = 0;
+    offsetX = 0;
+    stepBurnIn = 0;
+    lastShift = 0;
+    lastActivity = 0;
+    isDimmed = false;
+    for (uint8_t channel = 0; channel < SCREEN_HISTORY_COUNT; channel++) {
+        historyMinimum[channel] = 0;
+        historyMaximum[channel] = 0;
+    }
+    #ifndef SCREEN_PAGE_BUFFER
+        lastHash = 0;
+    #endif
+    timeLastFrame = 0;
+    bytesLastFrame = 0;
+    bytesSent = 0;
+    framesRendered = 0;
+    framesSkipped = 0;
+    framesFlushed = 0;
 }
 
-void Screen::begin() { screen->begin(); }
+void Screen::begin() {
+    screen->begin();
+    glyphCache.begin(*screen, u8g2_font_smart_patrol_nbp_tf);
+}
 
-void Screen::setRoomNumber(uint8_t roomNumber) { this->roomNumber = roomNumber; }
+void Screen::setRoomNumber(uint8_t roomNumber) {
+    if (this->roomNumber != roomNumber) {
+        dirtyStates |= SCREEN_STATE_ROOM_NUMBER;
+    }
+    this->roomNumber = roomNumber;
+}
 
-void Screen::isConnected(bool isConnected) { this->connectionState = isConnected; }
+void Screen::isConnected(bool isConnected) {
+    if (this->connectionState != isConnected) {
+        dirtyStates |= SCREEN_STATE_CONNECTION;
+    }
+    this->connectionState = isConnected;
+}
 
 bool Screen::isConnected() { return connectionState; }
 
-void Screen::isUpdated(bool isUpdated) { this->updateState = isUpdated; }
+void Screen::isUpdated(bool isUpdated) {
+    if (this->updateState != isUpdated) {
+        dirtyStates |= SCREEN_STATE_UPDATE;
+    }
+    this->updateState = isUpdated;
+}
 
 bool Screen::isUpdated() { return updateState; }
 
 
 // INSTALLATION and CONFIGURATION VIEWS
-void Screen::showInstallationRoomIDPage(const String messages[3]) {
-    screen->firstPage();
-    do {
+void Screen::showInstallationRoomIDPage(const char *const messages[3]) {
+    compose(SCREEN_PAGE_OTHER, false, [this, messages]() {
         drawRoomID();
-        drawMessage(positionMessageInstallationRoomIDPage[0], positionMessageInstallationRoomIDPage[1], messages[0]);
-        drawMessage(positionMessageInstallationRoomIDPage[0], positionMessageInstallationRoomIDPage[2], messages[1]);
-        drawMessage(positionMessageInstallationRoomIDPage[0], positionMessageInstallationRoomIDPage[3], messages[2]);
-    } while (screen->nextPage());
+        drawMessage(positionMessageInstallationRoomIDPage[0], positionMessageInstallationRoomIDPage[1], FPSTR(messages[0]));
+        drawMessage(positionMessageInstallationRoomIDPage[0], positionMessageInstallationRoomIDPage[2], FPSTR(messages[1]));
+        drawMessage(positionMessageInstallationRoomIDPage[0], positionMessageInstallationRoomIDPage[3], FPSTR(messages[2]));
+    });
 }
 
-void Screen::showInstallationWiFiPage(const String messages[6], uint8_t result) {
-    screen->firstPage();
-    do {
+void Screen::showInstallationWiFiPage(const char *const messages[6], uint8_t result) {
+    compose(SCREEN_PAGE_OTHER, false, [this, messages, result]() {
         drawWiFiStatus();
         switch (result) {
             case 0:
-                drawMessage(positionMessageInstallationWiFiPageCase0[0], positionMessageInstallationWiFiPageCase0[1], messages[0]);
-                drawMessage(positionMessageInstallationWiFiPageCase0[0], positionMessageInstallationWiFiPageCase0[2], messages[1]);
-                drawMessage(positionMessageInstallationWiFiPageCase0[0], positionMessageInstallationWiFiPageCase0[3], messages[2]);
+                drawMessage(positionMessageInstallationWiFiPageCase0[0], positionMessageInstallationWiFiPageCase0[1], FPSTR(messages[0]));
+                drawMessage(positionMessageInstallationWiFiPageCase0[0], positionMessageInstallationWiFiPageCase0[2], FPSTR(messages[1]));
+                drawMessage(positionMessageInstallationWiFiPageCase0[0], positionMessageInstallationWiFiPageCase0[3], FPSTR(messages[2]));
                 break;
             case 1:
-                drawMessage(positionMessageInstallationWiFiPageCase1[0], positionMessageInstallationWiFiPageCase1[1], messages[3]);
-                drawMessage(positionMessageInstallationWiFiPageCase1[0], positionMessageInstallationWiFiPageCase1[2], messages[4]);
+                drawMessage(positionMessageInstallationWiFiPageCase1[0], positionMessageInstallationWiFiPageCase1[1], FPSTR(messages[3]));
+                drawMessage(positionMessageInstallationWiFiPageCase1[0], positionMessageInstallationWiFiPageCase1[2], FPSTR(messages[4]));
                 break;
             case 2:
-                drawMessage(positionMessageInstallationWiFiPageCase2[0], positionMessageInstallationWiFiPageCase2[1], messages[5]);
+                drawMessage(positionMessageInstallationWiFiPageCase2[0], positionMessageInstallationWiFiPageCase2[1], FPSTR(messages[5]));
                 break;
             default:
                 break;
         }
-    } while (screen->nextPage());
+    });
 }
-void Screen::showUpgradeVersionThreePage(const String *messages, const String &localIP) {
-    screen->firstPage();
-    do {
-        drawMessage(positionMessageUpgradeVersionTwoPage[0], positionMessageUpgradeVersionTwoPage[2], messages[0]);
-        drawMessage(positionMessageUpgradeVersionTwoPage[0], positionMessageUpgradeVersionTwoPage[3], messages[1]);
+
+void Screen::showUpgradeVersionThreePage(const char *const messages[2], const String &localIP) {
+    compose(SCREEN_PAGE_OTHER, false, [this, messages, &localIP]() {
+        drawMessage(positionMessageUpgradeVersionTwoPage[0], positionMessageUpgradeVersionTwoPage[2], FPSTR(messages[0]));
+        drawMessage(positionMessageUpgradeVersionTwoPage[0], positionMessageUpgradeVersionTwoPage[3], FPSTR(messages[1]));
         drawMessage(positionMessageUpgradeVersionTwoPage[1], positionMessageUpgradeVersionTwoPage[4], localIP);
-    } while (screen->nextPage());
+    });
 }
 
 
 
 // ORDINARY VIEWS
-void Screen::showBrand(const String &version) {
-    screen->firstPage();
-    do {
+void Screen::showBrand(PGM_P version) {
+    compose(SCREEN_PAGE_OTHER, false, [this, version]() {
         drawBrand();
         drawVersion(version);
-    } while (screen->nextPage());
+    });
 }
 
-void Screen::showLoadingPage(const String &message, float percentage) {
-    screen->firstPage();
-    do {
+void Screen::showLoadingPage(PGM_P message, float percentage) {
+    compose(SCREEN_PAGE_OTHER, false, [this, message, percentage]() {
         drawBar(percentage);
-        drawMessage(positionMessageLoadingPage[0], positionMessageLoadingPage[1], message);
-    } while (screen->nextPage());
+        drawMessage(positionMessageLoadingPage[0], positionMessageLoadingPage[1], FPSTR(message));
+    });
+}
+
+void Screen::requestMainPage() { requestedPage = SCREEN_PAGE_MAIN; }
+
+void Screen::requestHistoryPage() { requestedPage = SCREEN_PAGE_HISTORY; }
+
+void Screen::requestOtherPage() { requestedPage = SCREEN_PAGE_OTHER; }
+
+screenPage_t Screen::getRequestedPage() { return requestedPage; }
+
+void Screen::wake() {
+    lastActivity = millis();
+
+    if (isDimmed) {
+        screen->setContrast(contrastNormal);
+        isDimmed = false;
+    }
+}
+
+void Screen::render() {
+    checkBurnIn(millis());
+
+    if (history.check(millis()) > 0) {
+        dirtyStates |= SCREEN_STATE_HISTORY;
+    }
+
+    switch (requestedPage) {
+        case SCREEN_PAGE_MAIN:
+            if (currentPage == SCREEN_PAGE_MAIN && (dirtyStates & SCREEN_STATE_MAIN_PAGE) == 0) {
+                return;
+            }
+            break;
+
+        case SCREEN_PAGE_HISTORY:
+            if (currentPage == SCREEN_PAGE_HISTORY && (dirtyStates & SCREEN_STATE_HISTORY) == 0) {
+                return;
+            }
+            break;
+
+        default:
+            return;
+    }
+
+    if (requestedPage == SCREEN_PAGE_MAIN) {
+        showMainPage();
+    } else {
+        showHistoryPage();
+    }
+}
+
+void Screen::showHistoryPage() {
+    requestedPage = SCREEN_PAGE_HISTORY;
+
+    /* The buffer still holds the previous history frame only if nothing else has been drawn since then. */
+    #ifdef SCREEN_PAGE_BUFFER
+        bool isIncremental = false;
+    #else
+        bool isIncremental = (currentPage == SCREEN_PAGE_HISTORY) && (history.getTotal() - historyDrawn == 1) && (history.size() > 1);
+    #endif
+
+    for (uint8_t channel = 0; channel < SCREEN_HISTORY_COUNT; channel++) {
+        int16_t minimum;
+        int16_t maximum;
+        history.getRange(static_cast<screenHistoryChannel_t>(channel), minimum, maximum);
+
+        /* A minimum span keeps the noise of a stable value from filling the plot. */
+        if (maximum - minimum < rangeMinimumHistory) {
+            minimum = (minimum + maximum - rangeMinimumHistory) / 2;
+            maximum = minimum + rangeMinimumHistory;
+        }
+
+        if (minimum != historyMinimum[channel] || maximum != historyMaximum[channel]) {
+            isIncremental = false;
+        }
+        historyMinimum[channel] = minimum;
+        historyMaximum[channel] = maximum;
+    }
+
+    #ifndef SCREEN_PAGE_BUFFER
+        if (isIncremental) {
+            shiftHistory();
+        }
+    #endif
+
+    historyDrawn = history.getTotal();
+    compose(SCREEN_PAGE_HISTORY, isIncremental, [this, isIncremental]() {
+        if (isIncremental) {
+            drawHistoryColumn(SCREEN_HISTORY_TEMPERATURE, 0);
+            drawHistoryColumn(SCREEN_HISTORY_HUMIDITY, 0);
+        } else {
+            screen->drawXBMP(positionLogoTemperature[0], positionLogoTemperature[1], logoTemperatureWidth, logoTemperatureHeight, logoTemperature);
+            screen->drawXBMP(positionLogoHumidity[0], positionLogoHumidity[1], logoHumidityWidth, logoHumidityHeight, logoHumidity);
+            for (uint8_t age = 0; age < history.size(); age++) {
+                drawHistoryColumn(SCREEN_HISTORY_TEMPERATURE, age);
+                drawHistoryColumn(SCREEN_HISTORY_HUMIDITY, age);
+            }
+        }
+    });
 }
 
 void Screen::showMainPage() {
-    screen->firstPage();
-    do {
-        drawRoomID();
-        drawTemperature();
-        drawHumidity();
-        drawWiFiStatus();
-        drawUpdateStatus();
-    } while (screen->nextPage());
+    requestedPage = SCREEN_PAGE_MAIN;
+
+    widgetsRedrawn = (1 << SCREEN_WIDGET_COUNT) - 1;
+    bool isIncremental = false;
+
+    #ifndef SCREEN_PAGE_BUFFER
+        if (currentPage == SCREEN_PAGE_MAIN) {
+            /* Only the widgets bound to the changed state, and those sharing their areas, are cleared and drawn again. */
+            isIncremental = true;
+            widgetsRedrawn = 0;
+            for (uint8_t i = 0; i < SCREEN_WIDGET_COUNT; i++) {
+                if (dirtyStates & layoutMainPage[i].states) {
+                    widgetsRedrawn |= layoutRedrawMainPage.masks[i];
+                }
+            }
+
+            for (uint8_t i = 0; i < SCREEN_WIDGET_COUNT; i++) {
+                if (widgetsRedrawn & (1 << i)) {
+                    clearArea(layoutMainPage[i].tileArea);
+                }
+            }
+        }
+    #endif
+
+    compose(SCREEN_PAGE_MAIN, isIncremental, [this]() {
+        for (uint8_t i = 0; i < SCREEN_WIDGET_COUNT; i++) {
+            if (widgetsRedrawn & (1 << i)) {
+                (this->*drawListMainPage[i])();
+            }
+        }
+    });
 }
 
-void Screen::clear() { screen->clear(); }
+uint16_t Screen::getBytesLastFrame() { return bytesLastFrame; }
+
+uint32_t Screen::getBytesSent() { return bytesSent; }
 
-void Screen::showMessagePage(const String &message) {
-    screen->firstPage();
-    do {
-        drawMessage(positionMessageMessagePage[0], positionMessageMessagePage[1], message);
-    } while (screen->nextPage());
+void Screen::clear() {
+    screen->clear();
+    currentPage = SCREEN_PAGE_NONE;
+    requestedPage = SCREEN_PAGE_NONE;
 }
 
-void Screen::showMessagePage(const String messages[2]) {
-    screen->firstPage();
-    do {
-        drawMessage(positionMessageMessagePage[0], positionMessageMessagePage[1] - 6, messages[0]);
-        drawMessage(positionMessageMessagePage[0], positionMessageMessagePage[1] + 6, messages[1]);
-    } while (screen->nextPage());
+uint32_t Screen::getFramesRendered() { return framesRendered; }
+
+uint32_t Screen::getFramesSkipped() { return framesSkipped; }
+
+uint32_t Screen::getFramesFlushed() { return framesFlushed; }
+
+unsigned long Screen::getTimeLastFrame() { return timeLastFrame; }
+
+#ifndef SCREEN_PAGE_BUFFER
+void Screen::flush(screenPage_t page) {
+    framesRendered++;
+    bytesLastFrame = 0;
+
+    const uint32_t hash = hashBuffer();
+    if (currentPage != SCREEN_PAGE_NONE && hash == lastHash) {
+        /* The display already shows these exact pixels: leave the bus to the sensor and the RTC. */
+        framesSkipped++;
+        dirtyStates = 0;
+        return;
+    }
+
+    if (page == SCREEN_PAGE_MAIN && currentPage == SCREEN_PAGE_MAIN) {
+        for (uint8_t i = 0; i < SCREEN_WIDGET_COUNT; i++) {
+            if (widgetsRedrawn & (1 << i)) {
+                flushArea(layoutMainPage[i].tileArea);
+            }
+        }
+    } else if (page == SCREEN_PAGE_HISTORY && currentPage == SCREEN_PAGE_HISTORY) {
+        flushArea(tileAreaHistory);
+    } else {
+        screen->sendBuffer();
+        bytesLastFrame = sizeFrame;
+        bytesSent += sizeFrame;
+    }
+
+    currentPage = page;
+    dirtyStates = 0;
+    lastHash = hash;
+    framesFlushed++;
+}
+
+uint32_t Screen::hashBuffer() {
+    const uint8_t *buffer = screen->getBufferPtr();
+    const uint16_t size = screen->getBufferTileWidth() * screen->getBufferTileHeight() * 8;
+
+    /* FNV-1a, 32 bit. */
+    uint32_t hash = 2166136261UL;
+    for (uint16_t i = 0; i < size; i++) {
+        hash ^= buffer[i];
+        hash *= 16777619UL;
+    }
+
+    return hash;
+}
+
+void Screen::clearArea(const uint8_t tileArea[4]) {
+    uint8_t *buffer = screen->getBufferPtr();
+    const uint16_t widthBuffer = screen->getBufferTileWidth() * 8;
+
+    for (uint8_t tileRow = tileArea[1]; tileRow < tileArea[1] + tileArea[3]; tileRow++) {
+        memset(buffer + tileRow * widthBuffer + tileArea[0] * 8, 0, tileArea[2] * 8);
+    }
+}
+
+void Screen::flushArea(const uint8_t tileArea[4]) {
+    screen->updateDisplayArea(tileArea[0], tileArea[1], tileArea[2], tileArea[3]);
+
+    /* Every tile is a column of 8 bytes. */
+    const uint16_t bytes = tileArea[2] * tileArea[3] * 8;
+    bytesLastFrame += bytes;
+    bytesSent += bytes;
+}
+
+void Screen::shiftHistory() {
+    uint8_t *buffer = screen->getBufferPtr();
+    const uint16_t widthBuffer = screen->getBufferTileWidth() * 8;
+
+    /* The buffer is made of rows of tiles, whose bytes are columns of 8 pixels: shifting a column is moving a byte. */
+    for (uint8_t tileRow = tileAreaHistory[1]; tileRow < tileAreaHistory[1] + tileAreaHistory[3]; tileRow++) {
+        uint8_t *row = buffer + tileRow * widthBuffer + positionPlotHistory[0];
+        memmove(row, row + 1, historyColumns - 1);
+        row[historyColumns - 1] = 0;
+    }
+}
+#endif
+
+void Screen::showMessagePage(PGM_P message) {
+    compose(SCREEN_PAGE_OTHER, false, [this, message]() {
+        drawMessage(positionMessageMessagePage[0], positionMessageMessagePage[1], FPSTR(message));
+    });
+}
+
+void Screen::showMessagePage(const char *const messages[2]) {
+    compose(SCREEN_PAGE_OTHER, false, [this, messages]() {
+        drawMessage(positionMessageMessagePage[0], positionMessageMessagePage[1] - 6, FPSTR(messages[0]));
+        drawMessage(positionMessageMessagePage[0], positionMessageMessagePage[1] + 6, FPSTR(messages[1]));
+    });
 }
 
 void Screen::drawBrand() {
     screen->setFont(u8g2_font_smart_patrol_nbp_tf);
     screen->setCursor(positionBrand[0], positionBrand[1]);
-    screen->print(brandPageMessage);
+    screen->print(FPSTR(brandPageMessage));
 }
 
-void Screen::drawVersion(const String &version) {
+void Screen::drawVersion(PGM_P version) {
     screen->setFont(u8g2_font_profont11_mf);
     screen->setCursor(positionVersion[0], positionVersion[1]);
-    screen->print("v" + version);
+    screen->print('v');
+    screen->print(FPSTR(version));
 }
 
 void Screen::drawBar(float percentage) {
@@ -131,71 +395,112 @@ void Screen::drawBar(float percentage) {
     screen->drawBox(positionFrameLoadingPage[0], positionFrameLoadingPage[1], widthFill, sizeFrameLoadingPage[1]);
 }
 
+void Screen::drawMessage(uint8_t positionX, uint8_t positionY, const __FlashStringHelper *message) {
+    screen->setFont(u8g2_font_profont11_mf);
+    screen->setCursor(positionX, positionY);
+    screen->print(message);
+}
+
 void Screen::drawMessage(uint8_t positionX, uint8_t positionY, const String &message) {
     screen->setFont(u8g2_font_profont11_mf);
     screen->drawStr(positionX, positionY, message.c_str());
 }
 
 void Screen::drawRoomID() {
-    screen->drawCircle(positionCircleRoomID[0], positionCircleRoomID[1], radiusCircleRoomID, U8G2_DRAW_ALL);
-    screen->setFont(u8g2_font_smart_patrol_nbp_tf);
+    screen->drawCircle(positionCircleRoomID[0] + offsetX, positionCircleRoomID[1], radiusCircleRoomID, U8G2_DRAW_ALL);
     if (roomNumber == 1) {
-        screen->setCursor(positionValueRoomID[0], positionValueRoomID[2]);
+        glyphCache.drawUnsigned(*screen, positionValueRoomID[0] + offsetX, positionValueRoomID[2], roomNumber);
     } else {
-        screen->setCursor(positionValueRoomID[1], positionValueRoomID[2]);
+        glyphCache.drawUnsigned(*screen, positionValueRoomID[1] + offsetX, positionValueRoomID[2], roomNumber);
     }
-    screen->print(roomNumber);
 }
 
 void Screen::drawTemperature() {
-    screen->drawXBMP(positionLogoTemperature[0], positionLogoTemperature[1], logoTemperatureWidth, logoTemperatureHeight, logoTemperature);
-    screen->setFont(u8g2_font_smart_patrol_nbp_tf);
-    screen->setCursor(positionValueTemperature[0], positionValueTemperature[1]);
-
+    screen->drawXBMP(positionLogoTemperature[0] + offsetX, positionLogoTemperature[1], logoTemperatureWidth, logoTemperatureHeight, logoTemperature);
     if (areValuesEmpty) {
-        screen->print("-");
+        glyphCache.drawString(*screen, positionValueTemperature[0] + offsetX, positionValueTemperature[1], "-");
     } else {
-        screen->print(temperature, 1);
+        glyphCache.drawTenths(*screen, positionValueTemperature[0] + offsetX, positionValueTemperature[1], temperatureTenths);
     }
 
-    screen->setCursor(positionUnitTemperature[0], positionUnitTemperature[1]);
-    screen->print(String((char) 176) + "C");
+    glyphCache.drawString(*screen, positionUnitTemperature[0] + offsetX, positionUnitTemperature[1], unitTemperature);
 }
 
 void Screen::drawHumidity() {
-    screen->drawXBMP(positionLogoHumidity[0], positionLogoHumidity[1], logoHumidityWidth, logoHumidityHeight, logoHumidity);
-    screen->setFont(u8g2_font_smart_patrol_nbp_tf);
-    screen->setCursor(positionValueHumidity[0], positionValueHumidity[1]);
-
+    screen->drawXBMP(positionLogoHumidity[0] + offsetX, positionLogoHumidity[1], logoHumidityWidth, logoHumidityHeight, logoHumidity);
     if (areValuesEmpty) {
-        screen->print("-");
+        glyphCache.drawString(*screen, positionValueHumidity[0] + offsetX, positionValueHumidity[1], "-");
     } else {
-        screen->print(humidity, 1);
+        glyphCache.drawTenths(*screen, positionValueHumidity[0] + offsetX, positionValueHumidity[1], humidityTenths);
     }
 
-    screen->setCursor(positionUnitHumidity[0], positionUnitHumidity[1]);
-    screen->print(" %");   
+    glyphCache.drawString(*screen, positionUnitHumidity[0] + offsetX, positionUnitHumidity[1], unitHumidity);
 }
 
 void Screen::drawWiFiStatus() {
     if (connectionState) {
         screen->setFont(u8g2_font_open_iconic_www_1x_t);
-        screen->drawGlyph(positionLogoWiFi[0], positionLogoWiFi[1], 0x0048); 
+        screen->drawGlyph(positionLogoWiFi[0] + offsetX, positionLogoWiFi[1], 0x0048); 
     }
 }
 
 void Screen::drawUpdateStatus() {
     if (!updateState) {
         screen->setFont(u8g2_font_open_iconic_embedded_1x_t);
-        screen->drawGlyph(positionLogoError[0], positionLogoError[1], 0x0047); 
+        screen->drawGlyph(positionLogoError[0] + offsetX, positionLogoError[1], 0x0047); 
     }
 }
 
+void Screen::drawHistoryColumn(screenHistoryChannel_t channel, uint8_t age) {
+    const uint8_t top = positionPlotHistory[1 + channel];
+    const int32_t span = historyMaximum[channel] - historyMinimum[channel];
+    const uint8_t positionX = positionPlotHistory[0] + historyColumns - 1 - age;
+
+    /* Rows grow downwards, so the maximum is on the top row of the plot. */
+    const uint8_t positionY = top + (heightPlotHistory - 1) - ((history.get(channel, age) - historyMinimum[channel]) * (heightPlotHistory - 1)) / span;
+    uint8_t positionYPrevious = positionY;
+    if (age + 1 < history.size()) {
+        positionYPrevious = top + (heightPlotHistory - 1) - ((history.get(channel, age + 1) - historyMinimum[channel]) * (heightPlotHistory - 1)) / span;
+    }
+
+    const uint8_t positionYTop = min(positionY, positionYPrevious);
+    screen->drawVLine(positionX, positionYTop, max(positionY, positionYPrevious) - positionYTop + 1);
+}
+
+void Screen::checkBurnIn(unsigned long now) {
+    if ((now - lastShift) >= timeBurnInShift) {
+        lastShift = now;
+        stepBurnIn = (stepBurnIn + 1) % (sizeof(offsetsBurnIn) / sizeof(offsetsBurnIn[0]));
+        offsetX = offsetsBurnIn[stepBurnIn];
+
+        /* Every widget stays into its own area, so the move is sent as partial updates. */
+        dirtyStates |= SCREEN_STATE_OFFSET;
+    }
+
+    if (!isDimmed && (now - lastActivity) >= timeBurnInDim) {
+        screen->setContrast(contrastDimmed);
+        isDimmed = true;
+    }
+}
+
+void Screen::updateLink(bool isConnected) { this->isConnected(isConnected); }
+
 void Screen::update(double temperature, double humidity) {
-    this->temperature = temperature;
-    this->humidity = humidity;
+    /* The values are shown with one decimal, so they are converted to fixed point once here, not on every frame. */
+    const int16_t temperatureTenths = static_cast<int16_t>(lround(temperature * 10));
+    const int16_t humidityTenths = static_cast<int16_t>(lround(humidity * 10));
 
-    this->areValuesEmpty = false;
+    if (areValuesEmpty || this->temperatureTenths != temperatureTenths) {
+        dirtyStates |= SCREEN_STATE_TEMPERATURE;
+    }
+    if (areValuesEmpty || this->humidityTenths != humidityTenths) {
+        dirtyStates |= SCREEN_STATE_HUMIDITY;
+    }
 
-    showMainPage();
+    this->temperatureTenths = temperatureTenths;
+    this->humidityTenths = humidityTenths;
+
+    history.add(temperatureTenths, humidityTenths, millis());
+
+    this->areValuesEmpty = false;
 }
\ No newline at end of file
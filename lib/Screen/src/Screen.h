@@ -4,14 +4,18 @@
  *
  * This library enables screen management as an observer, updating its state when notified by the subject class.
  *
+ * By default the whole frame buffer of 512 bytes is kept in RAM, so the frames are sent only if changed and, for the
+ * main and history pages, only in the changed areas. Building with `-D SCREEN_PAGE_BUFFER` keeps a single page of
+ * 128x8 pixels instead, saving 384 bytes of heap: every frame is then drawn once per page and sent in full.
+ *
  * Copyright (c) 2025 Davide Palladino.
  * All rights reserved.
  *
  * @author Davide Palladino
  * @contact davidepalladino@hotmail.com
  * @website https://davidepalladino.github.io/
- * @version 6.0.0
- * @date 6th February 2025
+ * @version 8.2.1
+ * @date 18th October 2026
  */
 
 #ifndef SCREEN_H
@@ -20,16 +24,31 @@
     #include <Arduino.h>
     #include <U8g2lib.h>
     #include <Sensor.h>
+    #include <WiFiConnectionObserver.h>
 
     #include "ScreenConsts.h"
+    #include "ScreenGlyphCache.h"
+    #include "ScreenFramebuffer.h"
+    #include "ScreenHistory.h"
+    #include "ScreenLayout.h"
+
+    #ifdef SCREEN_PAGE_BUFFER
+        typedef U8G2_SSD1306_128X32_UNIVISION_1_HW_I2C ScreenDisplay;
+    #else
+        typedef U8G2_SSD1306_128X32_UNIVISION_F_HW_I2C ScreenDisplay;
+    #endif
+
+    typedef enum screenPage : uint8_t {SCREEN_PAGE_NONE, SCREEN_PAGE_MAIN, SCREEN_PAGE_HISTORY, SCREEN_PAGE_OTHER} screenPage_t;
+
 
     /**
      * @class Screen
      * @brief Manages screen operations and updates for the Air Analyzer system.
      *
-     * This class observes the Sensor class and updates the screen accordingly.
+     * This class observes the Sensor class and updates the screen accordingly, and the WiFiConnection class for
+     *  the status of the link.
      */
-    class Screen : public SensorObserver {
+    class Screen : public SensorObserver, public WiFiConnectionObserver {
         public:
             /**
              * @brief Constructs a Screen object.
@@ -39,6 +58,14 @@
              */
             Screen(uint8_t pinSCL, uint8_t pinSDA);
 
+            /**
+             * @brief Constructs a Screen object that draws on the given display backend.
+             *
+             * @param display The display backend of 128x32 pixels (e.g., `ScreenFramebuffer`), with a full buffer unless
+             *  built with `SCREEN_PAGE_BUFFER`.
+             */
+            explicit Screen(U8G2 *display);
+
             /**
              * @brief Initializes the screen display.
              *
@@ -85,42 +112,42 @@
             /**
              * @brief Displays the installation page for room ID setup.
              * 
-             * @param messages An array of messages to display.
+             * @param messages An array of messages to display, stored in flash.
              */
-            void showInstallationRoomIDPage(const String messages[3]);
+            void showInstallationRoomIDPage(const char *const messages[3]);
 
             /**
              * @brief Displays the installation page for Wi-Fi setup.
              * 
-             * @param messages An array of messages to display.
+             * @param messages An array of messages to display, stored in flash.
              * @param result A status code representing the Wi-Fi connection result.
              */
-            void showInstallationWiFiPage(const String messages[6], uint8_t result);
+            void showInstallationWiFiPage(const char *const messages[6], uint8_t result);
 
             /**
              * @brief Displays the firmware upgrade version screen.
              * 
-             * @param messages Pointer to an array of messages.
+             * @param messages An array of two messages, stored in flash.
              * @param localIP The local IP address to display.
              */
-            void showUpgradeVersionThreePage(const String *messages, const String &localIP);
+            void showUpgradeVersionThreePage(const char *const messages[2], const String &localIP);
 
 
             // VIEWS ordinary
             /**
              * @brief Displays the brand logo along with the firmware version.
              * 
-             * @param version The firmware version string to be displayed.
+             * @param version The firmware version string to be displayed, stored in flash.
              */
-            void showBrand(const String &version);
+            void showBrand(PGM_P version);
 
             /**
              * @brief Displays a loading page with progress.
              * 
-             * @param message The loading message to display.
+             * @param message The loading message to display, stored in flash.
              * @param percentage The loading percentage value.
              */
-            void showLoadingPage(const String &message, float percentage);
+            void showLoadingPage(PGM_P message, float percentage);
 
             /**
              * @brief Displays the main screen page with the current sensor data.
@@ -128,37 +155,238 @@
              * This method updates the main screen to show the latest temperature and humidity readings.
              * It is typically called when new sensor data is available and needs to be presented
              * to the user in a clear and user-friendly format.
+             * If the main page is already shown, only the tiles of the widgets whose state changed are sent.
              *
              * @note This method assumes the screen has already been initialized and is ready for updates.
              */
             void showMainPage();
 
+            /**
+             * @brief Requests the main page, that will be composed by the next call of `render()`.
+             */
+            void requestMainPage();
+
+            /**
+             * @brief Displays the history page, with the sparklines of the last hours of temperature and humidity.
+             *
+             * If the history page is already shown and a single column has been added, the plots are shifted by one
+             *  pixel and only the newest column is drawn, so the cost does not depend on the length of the history.
+             */
+            void showHistoryPage();
+
+            /**
+             * @brief Requests the history page, that will be composed by the next call of `render()`.
+             */
+            void requestHistoryPage();
+
+            /**
+             * @brief Requests to keep the page drawn last by a `show*Page()` method, like a message, so `render()`
+             *  does not replace it until another page is requested.
+             */
+            void requestOtherPage();
+
+            /**
+             * @brief Gets the page kept shown by `render()`.
+             *
+             * @return The requested page, `SCREEN_PAGE_NONE` if the screen is cleared.
+             */
+            screenPage_t getRequestedPage();
+
+            /**
+             * @brief Registers an activity of the user, restoring the contrast if dimmed by the burn-in protection.
+             */
+            void wake();
+
+            /**
+             * @brief Composes and sends the requested page, if changed.
+             *
+             * The setters and `update()` only mark the widgets as dirty; this method has to be called once per frame
+             *  (every `timeFrameInterval`, by the task of the screen), so any number of changes between two frames
+             *  costs a single transfer to the display. The caller alone sets the frame rate.
+             * Other pages do not cancel the request: once they are no longer needed, the main page comes back.
+             * This method also runs the burn-in protection: every `timeBurnInShift` the main page moves by a pixel,
+             *  through partial updates, and after `timeBurnInDim` without activity the contrast is lowered.
+             */
+            void render();
+
+            /**
+             * @brief Gets the bytes sent to the display by the last frame.
+             *
+             * @return The number of bytes, 0 if the last frame had nothing to send.
+             */
+            uint16_t getBytesLastFrame();
+
+            /**
+             * @brief Gets the bytes sent to the display since boot.
+             *
+             * @return The number of bytes.
+             */
+            uint32_t getBytesSent();
+
+            /**
+             * @brief Gets the frames drawn into the buffer since boot.
+             *
+             * @return The number of frames.
+             */
+            uint32_t getFramesRendered();
+
+            /**
+             * @brief Gets the frames not sent to the display because identical to the one already shown.
+             *
+             * @return The number of frames.
+             */
+            uint32_t getFramesSkipped();
+
+            /**
+             * @brief Gets the frames sent, fully or partially, to the display.
+             *
+             * @return The number of frames.
+             */
+            uint32_t getFramesFlushed();
+
 
-            /** @brief Clears the screen display. */
+            /** @brief Clears the screen display, cancelling the request of the main page. */
             void clear();
 
             /**
              * @brief Displays a message on the screen.
              * 
-             * @param message The message to display.
+             * @param message The message to display, stored in flash.
              */
-            void showMessagePage(const String &message);
+            void showMessagePage(PGM_P message);
 
             /**
              * @brief Displays two messages on the screen.
              * 
-             * @param messages An array containing two messages to display.
+             * @param messages An array containing two messages to display, stored in flash.
+             */
+            void showMessagePage(const char *const messages[2]);
+
+            /**
+             * @brief Displays a page drawn by the caller, in both the full buffer and the page buffer modes.
+             *
+             * The callback receives the display and may be called more than once per frame, one for each page of
+             *  the buffer, so it has to draw the same content every time. It is not clipped: it draws the whole page.
+             *
+             * @param draw The callback, as `void (U8G2 &display)`.
+             */
+            template <typename Draw>
+            void showPage(Draw draw);
+
+            /**
+             * @brief Gets the time spent by the last frame, from the drawing to the end of the transfer.
+             *
+             * @return The time in microseconds.
+             */
+            unsigned long getTimeLastFrame();
+
+            /**
+             * @brief Updates the screen content based on the latest sensor data.
+             *
+             * This method stores the updated temperature and humidity values, marking the widgets to refresh on the
+             *  next frame composed by `render()`.
+             * It is typically invoked when the observed sensor detects changes in its readings.
+             *
+             * @param temperature The updated temperature value (in degrees Celsius).
+             * @param humidity The updated humidity value (as a percentage).
+             *
+             * @note
+             * - The screen must be initialized and displaying the appropriate page before calling this method.
+             * - Call this method only when new data is available from the sensor to avoid unnecessary updates.
+             */
+            void update(double temperature, double humidity) override;
+
+            /**
+             * @brief Updates the icon of the connection, when the observed link goes up or down.
+             *
+             * @param isConnected True if the link is up, false otherwise.
              */
-            void showMessagePage(const String messages[2]);
+            void updateLink(bool isConnected) override;
 
         private:
-            U8G2_SSD1306_128X32_UNIVISION_F_HW_I2C *screen;         /**< Pointer to the screen object. */
+            U8G2 *screen;                                           /**< Pointer to the display backend. */
+            ScreenGlyphCache glyphCache;                            /**< Glyphs of the values of the main page. */
             uint8_t roomNumber;                                     /**< Stores the room number. */
             bool connectionState;                                   /**< Stores the Wi-Fi connection status. */
             bool updateState;                                       /**< Stores the update status. */
-            double temperature;                                     /**< Stores the temperature value. */
-            double humidity;                                        /**< Stores the humidity value. */
+            int16_t temperatureTenths;                              /**< Stores the temperature value, in tenths of degree. */
+            int16_t humidityTenths;                                 /**< Stores the humidity value, in tenths of percentage. */
             bool areValuesEmpty;                                    /**< Stores the values status, if are empty or not. */
+            screenPage_t currentPage;                               /**< Stores the page actually shown on the display. */
+            screenPage_t requestedPage;                             /**< Stores the page that "render()" has to keep shown. */
+            uint8_t dirtyStates;                                    /**< Fields of the state changed since the last frame. */
+            uint8_t widgetsRedrawn;                                 /**< Widgets of the main page redrawn into the last frame. */
+            ScreenHistory history;                                  /**< Downsampled values of the history page. */
+            uint32_t historyDrawn;                                  /**< Columns of the history stored when the history page has been drawn. */
+            int16_t historyMinimum[SCREEN_HISTORY_COUNT];           /**< Bottom of the plots drawn, in tenths. */
+            int16_t historyMaximum[SCREEN_HISTORY_COUNT];           /**< Top of the plots drawn, in tenths. */
+            int8_t offsetX;                                         /**< Horizontal shift of the layout, for the burn-in protection. */
+            uint8_t stepBurnIn;                                     /**< Index of the actual shift into "offsetsBurnIn". */
+            unsigned long lastShift;                                /**< Time in milliseconds of the last shift of the layout. */
+            unsigned long lastActivity;                             /**< Time in milliseconds of the last activity of the user. */
+            bool isDimmed;                                          /**< Flag to indicate if the contrast is lowered. */
+            #ifndef SCREEN_PAGE_BUFFER
+                uint32_t lastHash;                                  /**< Hash of the buffer actually shown on the display. */
+            #endif
+            unsigned long timeLastFrame;                            /**< Time in microseconds spent by the last frame. */
+            uint16_t bytesLastFrame;                                /**< Bytes sent to the display by the last frame. */
+            uint32_t bytesSent;                                     /**< Bytes sent to the display since boot. */
+            uint32_t framesRendered;                                /**< Frames drawn into the buffer since boot. */
+            uint32_t framesSkipped;                                 /**< Frames identical to the one shown, so not sent. */
+            uint32_t framesFlushed;                                 /**< Frames sent to the display. */
+
+            /**
+             * @brief Draws a frame and sends it to the display.
+             *
+             * With the full buffer, the buffer is cleared unless the frame is incremental, then drawn and flushed.
+             * With the page buffer, the frame is drawn and sent once per page.
+             *
+             * @param page The page to draw.
+             * @param isIncremental True if the buffer holds the previous frame of the page, already prepared for the
+             *  changes; always false with the page buffer.
+             * @param draw The callback that draws the frame, as `void ()`.
+             */
+            template <typename Draw>
+            void compose(screenPage_t page, bool isIncremental, Draw draw);
+
+            #ifndef SCREEN_PAGE_BUFFER
+                /**
+                 * @brief Sends the buffer to the display, unless it is identical to the one already shown.
+                 *
+                 * The main page, if already shown, is sent only in the tile areas of its dirty widgets.
+                 *
+                 * @param page The page drawn into the buffer.
+                 */
+                void flush(screenPage_t page);
+
+                /**
+                 * @brief Computes the hash of the whole buffer.
+                 *
+                 * @return The FNV-1a hash of the buffer.
+                 */
+                uint32_t hashBuffer();
+
+                /**
+                 * @brief Sends an area of the buffer to the display.
+                 *
+                 * @param tileArea The area in tiles, as {tx, ty, tw, th}.
+                 */
+                void flushArea(const uint8_t tileArea[4]);
+
+                /**
+                 * @brief Clears an area of the buffer.
+                 *
+                 * @param tileArea The area in tiles, as {tx, ty, tw, th}.
+                 */
+                void clearArea(const uint8_t tileArea[4]);
+
+                /** @brief Shifts the plots of the history page left by one pixel, clearing the right edge. */
+                void shiftHistory();
+            #endif
+
+            typedef void (Screen::*ptrDraw)();
+
+            static const ptrDraw drawListMainPage[SCREEN_WIDGET_COUNT];     /**< Draw functions of the widgets, in the order of "layoutMainPage". */
 
             /** @brief Draws the brand logo on the screen. */
             void drawBrand();
@@ -166,9 +394,9 @@
             /**
              * @brief Draws the firmware version on the screen.
              * 
-             * @param version The firmware version string to display.
+             * @param version The firmware version string to display, stored in flash.
              */
-            void drawVersion(const String &version);
+            void drawVersion(PGM_P version);
 
             /**
              * @brief Draws a progress bar on the screen.
@@ -182,6 +410,15 @@
              * 
              * @param positionX X-coordinate of the message.
              * @param positionY Y-coordinate of the message.
+             * @param message The message to display, stored in flash and read while it is drawn.
+             */
+            void drawMessage(uint8_t positionX, uint8_t positionY, const __FlashStringHelper *message);
+
+            /**
+             * @brief Draws a message, held in RAM, at the specified position on the screen.
+             *
+             * @param positionX X-coordinate of the message.
+             * @param positionY Y-coordinate of the message.
              * @param message The message to display.
              */
             void drawMessage(uint8_t positionX, uint8_t positionY, const String &message);
@@ -216,19 +453,53 @@
             void drawUpdateStatus();
 
             /**
-             * @brief Updates the screen content based on the latest sensor data.
-             *
-             * This method refreshes the display to show the updated temperature and humidity values.
-             * It is typically invoked when the observed sensor detects changes in its readings.
+             * @brief Draws a column of the sparkline of a channel, joined to the previous one.
              *
-             * @param temperature The updated temperature value (in degrees Celsius).
-             * @param humidity The updated humidity value (as a percentage).
+             * @param channel The channel of the plot.
+             * @param age The age of the column, where 0 is the newest, drawn on the right edge.
+             */
+            void drawHistoryColumn(screenHistoryChannel_t channel, uint8_t age);
+
+            /**
+             * @brief Moves the layout and lowers the contrast, when their time is elapsed.
              *
-             * @note
-             * - The screen must be initialized and displaying the appropriate page before calling this method.
-             * - Call this method only when new data is available from the sensor to avoid unnecessary updates.
+             * @param now The actual time in milliseconds.
              */
-            void update(double temperature, double humidity) override;
+            void checkBurnIn(unsigned long now);
     };
 
+    template <typename Draw>
+    void Screen::showPage(Draw draw) {
+        compose(SCREEN_PAGE_OTHER, false, [this, &draw]() { draw(*screen); });
+    }
+
+    template <typename Draw>
+    void Screen::compose(screenPage_t page, bool isIncremental, Draw draw) {
+        const unsigned long start = micros();
+
+        #ifdef SCREEN_PAGE_BUFFER
+            /* Nothing of the previous frame is kept, so there is no frame to compare and nothing to skip. */
+            (void) isIncremental;
+            screen->firstPage();
+            do {
+                draw();
+            } while (screen->nextPage());
+
+            framesRendered++;
+            framesFlushed++;
+            bytesLastFrame = sizeFrame;
+            bytesSent += sizeFrame;
+            currentPage = page;
+            dirtyStates = 0;
+        #else
+            if (!isIncremental) {
+                screen->clearBuffer();
+            }
+            draw();
+            flush(page);
+        #endif
+
+        timeLastFrame = micros() - start;
+    }
+
 #endif // SCREEN_H
@@ -23,23 +23,79 @@
     constexpr uint8_t sizeFrameLoadingPage[2] =                             {108, 5};                       // width, height
     constexpr uint8_t radiusCircleRoomID =                                  10;
 
+    // Display, in tiles of 8x8 pixels. The areas of the widgets of the main page are in "ScreenLayout.h".
+    constexpr uint8_t widthDisplayTiles =                                   16;
+    constexpr uint8_t heightDisplayTiles =                                  4;
+    constexpr uint16_t sizeFrame =                                          512;                            // Bytes of a full frame.
+    // Glyphs of the values of the main page, rasterized at boot.
+    constexpr char glyphCacheCharacters[] =                                 "0123456789.- %C\xB0";
+    constexpr uint8_t glyphCacheWidth =                                     10;                             // Columns stored per glyph.
+    constexpr uint8_t glyphCacheHeight =                                    16;                             // Rows stored per glyph, at most 16.
+    constexpr uint8_t glyphCacheBaseline =                                  12;                             // Row of the baseline into the stored glyph.
+    constexpr char unitTemperature[] =                                      "\xB0" "C";
+    constexpr char unitHumidity[] =                                         " %";
+
+    // History page: "historyColumns" columns, each one the average of "timeHistoryColumn" milliseconds (4.8 hours in total).
+    constexpr uint8_t historyColumns =                                      96;
+    constexpr uint32_t timeHistoryColumn =                                  180000;
+    constexpr uint8_t positionPlotHistory[3] =                              {32, 1, 17};                    // x, y temperature, y humidity
+    constexpr uint8_t heightPlotHistory =                                   14;
+    constexpr int16_t rangeMinimumHistory =                                 10;                             // Minimum span of the plot, in tenths.
+    constexpr uint8_t tileAreaHistory[4] =                                  {4, 0, 12, 4};                  // tx, ty, tw, th
+
+    // Burn-in protection: the main page moves to the left along "offsetsBurnIn", and the contrast falls after inactivity.
+    constexpr int8_t offsetsBurnIn[4] =                                     {0, -1, -2, -1};                // x
+    constexpr uint32_t timeBurnInShift =                                    120000;
+    constexpr uint32_t timeBurnInDim =                                      60000;
+    constexpr uint8_t contrastNormal =                                      255;
+    constexpr uint8_t contrastDimmed =                                      16;
+
+    constexpr uint16_t timeFrameInterval =                                  100;                            // Milliseconds between two frames, so at most 10 per second.
+
     constexpr uint8_t logoTemperatureWidth =                                14;
     constexpr uint8_t logoTemperatureHeight =                               14;
     constexpr uint8_t logoHumidityWidth =                                   14;
     constexpr uint8_t logoHumidityHeight =                                  14;
 
-    const String brandPageMessage =                                         "Air Analyzer";
-    const String messagePageResetCompleteMessages =                         "RESET COMPLETE";
-    const String messagePageSocketRequest =                                 "EXTERNAL REQUEST";
-    const String messagePageFirmwareUpdated[2] =                            {"FIRMWARE UPDATED", "RESTARTING..." };
-    const String installationRoomIDPageMessages[3] =                        {"Short press to", "change the ID. ", "Long press to finish."};
-    const String installationRoomWiFiPageMessages[6] =                      {"Search error, no", "connection revealed.", "Try again!", "Short press to start", "WPS connection.", "Searching..."};
-    const String upgradeConfigurationToVersionTwoMessages[2] =              {"Put this IP in your", "app to complete:"};
-    const String loadingPageMessages[6] =                                   {"GETTING EEPROM", "CONNECTING WIFI", "CHECKING FIRMWARE", "SETTING DATABASE", "SETTING SENSOR", "SETTING SCREEN"};
-    const String messagePageInstallationCompleteMessages[2] =               {"INSTALLATION", "COMPLETE"};
-    const String messagePageSearchingMessage =                              {"WPS CONNECTION..."};
-    const String messagePageSuccessfulMessage =                             {"CONNECTED!"};
-    const String messagePageErrorMessages[2] =                              {"NO NEW CONNECTION", "REVEALED!"};
+    // Messages, stored in flash and drawn without copying them into RAM.
+    inline const char brandPageMessage[] PROGMEM =                          "Air Analyzer";
+    inline const char messagePageResetCompleteMessages[] PROGMEM =          "RESET COMPLETE";
+    inline const char messagePageSocketRequest[] PROGMEM =                  "EXTERNAL REQUEST";
+    inline const char messagePageSearchingMessage[] PROGMEM =               "WPS CONNECTION...";
+    inline const char messagePageSuccessfulMessage[] PROGMEM =              "CONNECTED!";
+
+    inline const char messagePageFirmwareUpdated0[] PROGMEM =               "FIRMWARE UPDATED";
+    inline const char messagePageFirmwareUpdated1[] PROGMEM =               "RESTARTING...";
+    inline const char installationRoomIDPageMessages0[] PROGMEM =           "Short press to";
+    inline const char installationRoomIDPageMessages1[] PROGMEM =           "change the ID. ";
+    inline const char installationRoomIDPageMessages2[] PROGMEM =           "Long press to finish.";
+    inline const char installationRoomWiFiPageMessages0[] PROGMEM =         "Search error, no";
+    inline const char installationRoomWiFiPageMessages1[] PROGMEM =         "connection revealed.";
+    inline const char installationRoomWiFiPageMessages2[] PROGMEM =         "Try again!";
+    inline const char installationRoomWiFiPageMessages3[] PROGMEM =         "Short press to start";
+    inline const char installationRoomWiFiPageMessages4[] PROGMEM =         "WPS connection.";
+    inline const char installationRoomWiFiPageMessages5[] PROGMEM =         "Searching...";
+    inline const char upgradeConfigurationToVersionTwoMessages0[] PROGMEM = "Put this IP in your";
+    inline const char upgradeConfigurationToVersionTwoMessages1[] PROGMEM = "app to complete:";
+    inline const char loadingPageMessages0[] PROGMEM =                      "GETTING EEPROM";
+    inline const char loadingPageMessages1[] PROGMEM =                      "CONNECTING WIFI";
+    inline const char loadingPageMessages2[] PROGMEM =                      "CHECKING FIRMWARE";
+    inline const char loadingPageMessages3[] PROGMEM =                      "SETTING DATABASE";
+    inline const char loadingPageMessages4[] PROGMEM =                      "SETTING SENSOR";
+    inline const char loadingPageMessages5[] PROGMEM =                      "SETTING SCREEN";
+    inline const char messagePageInstallationCompleteMessages0[] PROGMEM =  "INSTALLATION";
+    inline const char messagePageInstallationCompleteMessages1[] PROGMEM =  "COMPLETE";
+    inline const char messagePageErrorMessages0[] PROGMEM =                 "NO NEW CONNECTION";
+    inline const char messagePageErrorMessages1[] PROGMEM =                 "REVEALED!";
+
+    // Tables of the messages above; only the pointers stay in RAM.
+    inline const char *const messagePageFirmwareUpdated[2] =                {messagePageFirmwareUpdated0, messagePageFirmwareUpdated1};
+    inline const char *const installationRoomIDPageMessages[3] =            {installationRoomIDPageMessages0, installationRoomIDPageMessages1, installationRoomIDPageMessages2};
+    inline const char *const installationRoomWiFiPageMessages[6] =          {installationRoomWiFiPageMessages0, installationRoomWiFiPageMessages1, installationRoomWiFiPageMessages2, installationRoomWiFiPageMessages3, installationRoomWiFiPageMessages4, installationRoomWiFiPageMessages5};
+    inline const char *const upgradeConfigurationToVersionTwoMessages[2] =  {upgradeConfigurationToVersionTwoMessages0, upgradeConfigurationToVersionTwoMessages1};
+    inline const char *const loadingPageMessages[6] =                       {loadingPageMessages0, loadingPageMessages1, loadingPageMessages2, loadingPageMessages3, loadingPageMessages4, loadingPageMessages5};
+    inline const char *const messagePageInstallationCompleteMessages[2] =   {messagePageInstallationCompleteMessages0, messagePageInstallationCompleteMessages1};
+    inline const char *const messagePageErrorMessages[2] =                  {messagePageErrorMessages0, messagePageErrorMessages1};
 
     inline unsigned char logoTemperature[] PROGMEM = {
         0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01,
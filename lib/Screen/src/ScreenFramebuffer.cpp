@@ -0,0 +1,97 @@
+#include "ScreenFramebuffer.h"
+
+ScreenFramebuffer *ScreenFramebuffer::instances = nullptr;
+
+ScreenFramebuffer::ScreenFramebuffer() : U8G2() {
+    /* Same controller of the device, but with callbacks that drop every byte. */
+    #ifdef SCREEN_PAGE_BUFFER
+        u8g2_Setup_ssd1306_128x32_univision_1(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    #else
+        u8g2_Setup_ssd1306_128x32_univision_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+    #endif
+
+    /* U8g2 gives the same static buffer to every display of a kind, so two backends would draw on each other. */
+    u8g2.tile_buf_ptr = buffer;
+
+    memset(image, 0, sizeof(image));
+    tilesSent = 0;
+
+    displayCallback = u8g2.u8x8.display_cb;
+    u8g2.u8x8.display_cb = captureDisplay;
+
+    next = instances;
+    instances = this;
+}
+
+ScreenFramebuffer::~ScreenFramebuffer() {
+    for (ScreenFramebuffer **instance = &instances; *instance != nullptr; instance = &(*instance)->next) {
+        if (*instance == this) {
+            *instance = next;
+            break;
+        }
+    }
+}
+
+bool ScreenFramebuffer::getPixel(uint8_t x, uint8_t y) const {
+    const uint16_t width = widthDisplayTiles * 8;
+    if (x >= width || y >= heightDisplayTiles * 8) {
+        return false;
+    }
+
+    return (image[(y >> 3) * width + x] >> (y & 7)) & 1;
+}
+
+uint32_t ScreenFramebuffer::getTilesSent() const { return tilesSent; }
+
+void ScreenFramebuffer::resetTilesSent() { tilesSent = 0; }
+
+size_t ScreenFramebuffer::writePBM(Print &output) const {
+    const uint8_t width = widthDisplayTiles * 8;
+    const uint8_t height = heightDisplayTiles * 8;
+
+    size_t written = output.print(F("P4\n"));
+    written += output.print(width);
+    written += output.print(' ');
+    written += output.print(height);
+    written += output.print('\n');
+
+    /* PBM rows are packed horizontally, most significant bit first; the image is packed vertically. */
+    for (uint8_t y = 0; y < height; y++) {
+        for (uint8_t x = 0; x < width; x += 8) {
+            uint8_t packed = 0;
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                if (getPixel(x + bit, y)) {
+                    packed |= 0x80 >> bit;
+                }
+            }
+            written += output.write(packed);
+        }
+    }
+
+    return written;
+}
+
+uint8_t ScreenFramebuffer::captureDisplay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) {
+    ScreenFramebuffer *framebuffer = instances;
+    while (framebuffer != nullptr && framebuffer->getU8x8() != u8x8) {
+        framebuffer = framebuffer->next;
+    }
+    if (framebuffer == nullptr) {
+        return 0;
+    }
+
+    if (msg == U8X8_MSG_DISPLAY_DRAW_TILE) {
+        const u8x8_tile_t *tile = static_cast<const u8x8_tile_t *>(arg_ptr);
+
+        /* The same tiles can be repeated "arg_int" times along the row, as U8g2 allows. */
+        uint8_t column = tile->x_pos;
+        for (uint8_t repetition = 0; repetition < arg_int; repetition++) {
+            for (uint8_t i = 0; i < tile->cnt && column < widthDisplayTiles && tile->y_pos < heightDisplayTiles; i++, column++) {
+                memcpy(framebuffer->image + (tile->y_pos * widthDisplayTiles + column) * 8, tile->tile_ptr + i * 8, 8);
+                framebuffer->tilesSent++;
+            }
+        }
+    }
+
+    return framebuffer->displayCallback(u8x8, msg, arg_int, arg_ptr);
+}
@@ -0,0 +1,85 @@
+/**
+ * @file ScreenFramebuffer.h
+ * @brief Provides a display backend that renders into memory only, without any bus.
+ *
+ * The backend has the same controller and buffer layout of the SSD1306 128x32 used by the device, so the Screen
+ * draws exactly the same pixels. The tiles sent to the controller are copied into an image of the display, so what
+ * is read back is what the display would show, also after partial updates or with the page buffer.
+ * It allows to check layouts and to measure the rendering time without the display, and to export what would be
+ * shown as PBM image.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.2.0
+ * @date 18th October 2026
+ */
+
+#ifndef SCREENFRAMEBUFFER_H
+    #define SCREENFRAMEBUFFER_H
+
+    #include <Arduino.h>
+    #include <U8g2lib.h>
+
+    #include "ScreenConsts.h"
+
+    /**
+     * @class ScreenFramebuffer
+     * @brief U8g2 display of 128x32 pixels whose transfers are kept in memory; with `SCREEN_PAGE_BUFFER` defined,
+     *  it uses the page buffer of one tile row, as the Screen on the device.
+     */
+    class ScreenFramebuffer : public U8G2 {
+        public:
+            ScreenFramebuffer();
+            ~ScreenFramebuffer();
+
+            ScreenFramebuffer(const ScreenFramebuffer &) = delete;
+            ScreenFramebuffer &operator=(const ScreenFramebuffer &) = delete;
+
+            /**
+             * @brief Gets a pixel of the image shown by the display.
+             *
+             * @param x X-coordinate of the pixel.
+             * @param y Y-coordinate of the pixel.
+             * @return True if the pixel is on, false otherwise or if out of the display.
+             */
+            bool getPixel(uint8_t x, uint8_t y) const;
+
+            /**
+             * @brief Gets the number of tiles sent to the display since the last reset.
+             *
+             * @return The number of tiles of 8x8 pixels.
+             */
+            uint32_t getTilesSent() const;
+
+            /**
+             * @brief Resets the number of tiles sent to the display.
+             */
+            void resetTilesSent();
+
+            /**
+             * @brief Writes the image shown by the display as binary PBM (P4) image.
+             *
+             * @param output The destination of the image (e.g., Serial, a file).
+             * @return The number of bytes written.
+             */
+            size_t writePBM(Print &output) const;
+
+        private:
+            static ScreenFramebuffer *instances;                    /**< Backends alive, to find the one of a callback. */
+            ScreenFramebuffer *next;                                /**< Next backend alive. */
+            u8x8_msg_cb displayCallback;                            /**< Callback of the controller, wrapped to capture the tiles. */
+            uint8_t buffer[sizeFrame];                              /**< Buffer drawn, of this backend only. */
+            uint8_t image[sizeFrame];                               /**< Image of the display, in the layout of the buffer. */
+            uint32_t tilesSent;                                     /**< Number of tiles sent since the last reset. */
+
+            /**
+             * @brief Copies the tiles drawn into the image, then passes every message to the controller.
+             */
+            static uint8_t captureDisplay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+    };
+
+#endif // SCREENFRAMEBUFFER_H
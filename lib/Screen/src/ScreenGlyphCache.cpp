@@ -0,0 +1,128 @@
+#include "ScreenGlyphCache.h"
+
+ScreenGlyphCache::ScreenGlyphCache() : font(nullptr), isReady(false) { }
+
+void ScreenGlyphCache::begin(U8G2 &screen, const uint8_t *font) {
+    this->font = font;
+
+    const uint8_t *buffer = screen.getBufferPtr();
+    const uint16_t widthBuffer = screen.getBufferTileWidth() * 8;
+    if (screen.getBufferTileHeight() * 8 < glyphCacheHeight) {
+        /* A page buffer cannot hold a whole glyph: every character will be drawn through the font. */
+        return;
+    }
+
+    /* The descent is negative: the glyphs go from "ascent" rows above the baseline to "-descent" rows below it. */
+    screen.setFont(font);
+    if (screen.getMaxCharWidth() > glyphCacheWidth || screen.getAscent() > glyphCacheBaseline || glyphCacheBaseline - screen.getDescent() > glyphCacheHeight) {
+        Serial.println(F("\033[1;91m[SCREEN ERROR: FONT LARGER THAN THE GLYPH CACHE, DRAWN THROUGH THE FONT]\033[0m"));
+        return;
+    }
+
+    for (uint8_t i = 0; i < SIZE; i++) {
+        screen.clearBuffer();
+        advances[i] = screen.drawGlyph(0, glyphCacheBaseline, static_cast<uint8_t>(glyphCacheCharacters[i]));
+
+        for (uint8_t column = 0; column < glyphCacheWidth; column++) {
+            uint16_t bits = 0;
+            for (uint8_t row = 0; row < glyphCacheHeight; row++) {
+                if ((buffer[(row >> 3) * widthBuffer + column] >> (row & 7)) & 1) {
+                    bits |= 1 << row;
+                }
+            }
+            columns[i][column] = bits;
+        }
+    }
+    screen.clearBuffer();
+
+    isReady = true;
+}
+
+uint8_t ScreenGlyphCache::drawString(U8G2 &screen, int16_t x, int16_t y, const char *text) const {
+    uint8_t advance = 0;
+    while (*text != '\0') {
+        advance += drawCharacter(screen, x + advance, y, *text++);
+    }
+
+    return advance;
+}
+
+uint8_t ScreenGlyphCache::drawTenths(U8G2 &screen, int16_t x, int16_t y, int32_t tenths) const {
+    char text[14];
+    char *end = text;
+
+    if (tenths < 0) {
+        *end++ = '-';
+        tenths = -tenths;
+    }
+    end = formatUnsigned(static_cast<uint32_t>(tenths) / 10, end);
+    *end++ = '.';
+    *end++ = static_cast<char>('0' + tenths % 10);
+    *end = '\0';
+
+    return drawString(screen, x, y, text);
+}
+
+uint8_t ScreenGlyphCache::drawUnsigned(U8G2 &screen, int16_t x, int16_t y, uint32_t value) const {
+    char text[11];
+    *formatUnsigned(value, text) = '\0';
+
+    return drawString(screen, x, y, text);
+}
+
+int8_t ScreenGlyphCache::indexOf(char character) const {
+    for (uint8_t i = 0; i < SIZE; i++) {
+        if (glyphCacheCharacters[i] == character) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+uint8_t ScreenGlyphCache::drawCharacter(U8G2 &screen, int16_t x, int16_t y, char character) const {
+    const int8_t index = isReady ? indexOf(character) : -1;
+    if (index < 0) {
+        screen.setFont(font);
+        return screen.drawGlyph(x, y, static_cast<uint8_t>(character));
+    }
+
+    uint8_t *buffer = screen.getBufferPtr();
+    const int16_t widthBuffer = screen.getBufferTileWidth() * 8;
+    const int16_t heightBuffer = screen.getBufferTileHeight() * 8;
+    const int16_t top = y - glyphCacheBaseline;
+
+    /* Pixels outside the buffer are clipped, as U8g2 does. */
+    for (uint8_t column = 0; column < glyphCacheWidth; column++) {
+        const int16_t positionX = x + column;
+        if (positionX < 0 || positionX >= widthBuffer) {
+            continue;
+        }
+
+        uint16_t bits = columns[index][column];
+        for (uint8_t row = 0; bits != 0; row++, bits >>= 1) {
+            const int16_t positionY = top + row;
+            if ((bits & 1) && positionY >= 0 && positionY < heightBuffer) {
+                buffer[(positionY >> 3) * widthBuffer + positionX] |= 1 << (positionY & 7);
+            }
+        }
+    }
+
+    return advances[index];
+}
+
+char *ScreenGlyphCache::formatUnsigned(uint32_t value, char *text) {
+    char digits[10];
+    uint8_t count = 0;
+
+    do {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    while (count > 0) {
+        *text++ = digits[--count];
+    }
+
+    return text;
+}
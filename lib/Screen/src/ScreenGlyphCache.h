@@ -0,0 +1,102 @@
+/**
+ * @file ScreenGlyphCache.h
+ * @brief Provides a cache of pre-rasterized glyphs, blitted directly into the frame buffer.
+ *
+ * The values of the main page change every few seconds but are drawn with the same few characters. Rasterizing
+ * them once at boot avoids, on every frame, the lookup and decoding of the glyphs in the compressed font and the
+ * formatting of floating point numbers on a CPU without FPU.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.1.0
+ * @date 18th October 2026
+ */
+
+#ifndef SCREENGLYPHCACHE_H
+    #define SCREENGLYPHCACHE_H
+
+    #include <Arduino.h>
+    #include <U8g2lib.h>
+
+    #include "ScreenConsts.h"
+
+    /**
+     * @class ScreenGlyphCache
+     * @brief Stores the columns of the glyphs of `glyphCacheCharacters` for a single font.
+     *
+     * Each glyph is kept as `glyphCacheWidth` columns of `glyphCacheHeight` bits, with the baseline on the row
+     *  `glyphCacheBaseline`. Characters not in the cache are drawn through the font, so the output is the same.
+     */
+    class ScreenGlyphCache {
+        public:
+            ScreenGlyphCache();
+
+            /**
+             * @brief Rasterizes the glyphs of the font into the cache.
+             *
+             * The frame buffer is used as scratch area, so it is cleared at the end. If the glyphs of the font do not fit
+             *  the cell of `glyphCacheWidth` x `glyphCacheHeight` with the baseline on `glyphCacheBaseline`, the cache is
+             *  left empty and every character is drawn through the font.
+             *
+             * @param screen The screen that owns the frame buffer.
+             * @param font The font to rasterize.
+             */
+            void begin(U8G2 &screen, const uint8_t *font);
+
+            /**
+             * @brief Draws a string, like `drawStr()` of U8g2.
+             *
+             * @param screen The screen that owns the frame buffer.
+             * @param x X-coordinate of the first character.
+             * @param y Y-coordinate of the baseline.
+             * @param text The string to draw.
+             * @return The advance in pixels.
+             */
+            uint8_t drawString(U8G2 &screen, int16_t x, int16_t y, const char *text) const;
+
+            /**
+             * @brief Draws a value with one decimal, given in tenths (e.g., 215 as "21.5").
+             *
+             * @param screen The screen that owns the frame buffer.
+             * @param x X-coordinate of the first character.
+             * @param y Y-coordinate of the baseline.
+             * @param tenths The value multiplied by 10 and rounded.
+             * @return The advance in pixels.
+             */
+            uint8_t drawTenths(U8G2 &screen, int16_t x, int16_t y, int32_t tenths) const;
+
+            /**
+             * @brief Draws an unsigned integer value.
+             *
+             * @param screen The screen that owns the frame buffer.
+             * @param x X-coordinate of the first character.
+             * @param y Y-coordinate of the baseline.
+             * @param value The value to draw.
+             * @return The advance in pixels.
+             */
+            uint8_t drawUnsigned(U8G2 &screen, int16_t x, int16_t y, uint32_t value) const;
+
+        private:
+            static constexpr uint8_t SIZE = sizeof(glyphCacheCharacters) - 1;
+
+            const uint8_t *font;                                    /**< Font used for the characters not in the cache. */
+            uint16_t columns[SIZE][glyphCacheWidth];                /**< Columns of the glyphs, with the top row on the least significant bit. */
+            uint8_t advances[SIZE];                                 /**< Advance in pixels of the glyphs. */
+            bool isReady;                                           /**< Flag to indicate if the cache has been rasterized. */
+
+            int8_t indexOf(char character) const;
+            uint8_t drawCharacter(U8G2 &screen, int16_t x, int16_t y, char character) const;
+
+            /**
+             * @brief Writes the decimal digits of a value, without terminator.
+             *
+             * @return The pointer after the last digit written.
+             */
+            static char *formatUnsigned(uint32_t value, char *text);
+    };
+
+#endif // SCREENGLYPHCACHE_H
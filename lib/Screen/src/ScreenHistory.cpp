@@ -0,0 +1,65 @@
+#include "ScreenHistory.h"
+
+ScreenHistory::ScreenHistory() : head(0), count(0), total(0), samples(0), startColumn(0), isStarted(false) {
+    for (uint8_t channel = 0; channel < SCREEN_HISTORY_COUNT; channel++) {
+        sums[channel] = 0;
+        lastValues[channel] = 0;
+    }
+}
+
+void ScreenHistory::add(int16_t temperatureTenths, int16_t humidityTenths, unsigned long now) {
+    if (!isStarted) {
+        isStarted = true;
+        startColumn = now;
+    }
+
+    lastValues[SCREEN_HISTORY_TEMPERATURE] = temperatureTenths;
+    lastValues[SCREEN_HISTORY_HUMIDITY] = humidityTenths;
+
+    sums[SCREEN_HISTORY_TEMPERATURE] += temperatureTenths;
+    sums[SCREEN_HISTORY_HUMIDITY] += humidityTenths;
+    samples++;
+}
+
+uint8_t ScreenHistory::check(unsigned long now) {
+    uint8_t stored = 0;
+
+    /* Unsigned subtraction keeps the interval right across the overflow of "millis()". */
+    while (isStarted && (now - startColumn) >= timeHistoryColumn) {
+        for (uint8_t channel = 0; channel < SCREEN_HISTORY_COUNT; channel++) {
+            values[channel][head] = (samples > 0) ? static_cast<int16_t>(sums[channel] / samples) : lastValues[channel];
+            sums[channel] = 0;
+        }
+        samples = 0;
+
+        head = (head + 1) % historyColumns;
+        if (count < historyColumns) {
+            count++;
+        }
+        total++;
+
+        startColumn += timeHistoryColumn;
+        stored++;
+    }
+
+    return stored;
+}
+
+uint8_t ScreenHistory::size() const { return count; }
+
+uint32_t ScreenHistory::getTotal() const { return total; }
+
+int16_t ScreenHistory::get(screenHistoryChannel_t channel, uint8_t age) const {
+    return values[channel][(head + historyColumns - 1 - age) % historyColumns];
+}
+
+void ScreenHistory::getRange(screenHistoryChannel_t channel, int16_t &minimum, int16_t &maximum) const {
+    minimum = INT16_MAX;
+    maximum = INT16_MIN;
+
+    for (uint8_t age = 0; age < count; age++) {
+        const int16_t value = get(channel, age);
+        minimum = min(minimum, value);
+        maximum = max(maximum, value);
+    }
+}
@@ -0,0 +1,97 @@
+/**
+ * @file ScreenHistory.h
+ * @brief Provides the ring buffer of downsampled values shown by the history page of the Screen.
+ *
+ * Every column of the history is the average of the values received during `timeHistoryColumn`, in tenths, so a
+ * few hundred bytes cover the last hours of both channels. When no value is received during a column, because
+ * the sensor notifies only the changes, the last one is repeated.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef SCREENHISTORY_H
+    #define SCREENHISTORY_H
+
+    #include <Arduino.h>
+
+    #include "ScreenConsts.h"
+
+    typedef enum screenHistoryChannel : uint8_t {SCREEN_HISTORY_TEMPERATURE, SCREEN_HISTORY_HUMIDITY, SCREEN_HISTORY_COUNT} screenHistoryChannel_t;
+
+    /**
+     * @class ScreenHistory
+     * @brief Stores up to `historyColumns` columns per channel, overwriting the oldest.
+     */
+    class ScreenHistory {
+        public:
+            ScreenHistory();
+
+            /**
+             * @brief Accumulates a value into the actual column.
+             *
+             * @param temperatureTenths The temperature, in tenths of degree.
+             * @param humidityTenths The humidity, in tenths of percentage.
+             * @param now The actual time in milliseconds.
+             */
+            void add(int16_t temperatureTenths, int16_t humidityTenths, unsigned long now);
+
+            /**
+             * @brief Closes the columns whose time is elapsed.
+             *
+             * @param now The actual time in milliseconds.
+             * @return The number of columns stored by this call.
+             */
+            uint8_t check(unsigned long now);
+
+            /**
+             * @brief Gets the number of stored columns.
+             *
+             * @return The number of stored columns, at most `historyColumns`.
+             */
+            uint8_t size() const;
+
+            /**
+             * @brief Gets the number of columns stored since boot, to detect how many were added after a given moment.
+             *
+             * @return The number of columns stored since boot.
+             */
+            uint32_t getTotal() const;
+
+            /**
+             * @brief Gets a stored column.
+             *
+             * @param channel The channel to read.
+             * @param age The age of the column, where 0 is the newest.
+             * @return The value, in tenths.
+             */
+            int16_t get(screenHistoryChannel_t channel, uint8_t age) const;
+
+            /**
+             * @brief Gets the minimum and maximum of the stored columns of a channel.
+             *
+             * @param channel The channel to read.
+             * @param minimum Output of the minimum, in tenths.
+             * @param maximum Output of the maximum, in tenths.
+             */
+            void getRange(screenHistoryChannel_t channel, int16_t &minimum, int16_t &maximum) const;
+
+        private:
+            int16_t values[SCREEN_HISTORY_COUNT][historyColumns];  /**< Ring buffer of the columns. */
+            uint8_t head;                                           /**< Index of the next column to write. */
+            uint8_t count;                                          /**< Number of stored columns. */
+            uint32_t total;                                         /**< Number of columns stored since boot. */
+            int32_t sums[SCREEN_HISTORY_COUNT];                     /**< Sums of the values of the actual column. */
+            uint16_t samples;                                       /**< Number of values of the actual column. */
+            int16_t lastValues[SCREEN_HISTORY_COUNT];               /**< Last values received. */
+            unsigned long startColumn;                              /**< Time in milliseconds of the start of the actual column. */
+            bool isStarted;                                         /**< Flag to indicate if at least one value has been received. */
+    };
+
+#endif // SCREENHISTORY_H
@@ -0,0 +1,141 @@
+/**
+ * @file ScreenLayout.h
+ * @brief Describes at compile time the widgets of the main page, with their areas and the state they depend on.
+ *
+ * The Screen uses this description to redraw and send only the widgets bound to the state that changed. The
+ * consistency of the layout (areas inside the display, contents inside their areas for every shift of the
+ * burn-in protection) is checked by the compiler, and the widgets to redraw together, because their areas
+ * overlap, are computed by the compiler too.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef SCREENLAYOUT_H
+    #define SCREENLAYOUT_H
+
+    #include <Arduino.h>
+
+    #include "ScreenConsts.h"
+
+    // Fields of the state of the Screen; a change of one of them makes dirty the widgets bound to it.
+    constexpr uint8_t SCREEN_STATE_ROOM_NUMBER =    0x01;
+    constexpr uint8_t SCREEN_STATE_TEMPERATURE =    0x02;
+    constexpr uint8_t SCREEN_STATE_HUMIDITY =       0x04;
+    constexpr uint8_t SCREEN_STATE_CONNECTION =     0x08;
+    constexpr uint8_t SCREEN_STATE_UPDATE =         0x10;
+    constexpr uint8_t SCREEN_STATE_OFFSET =         0x20;
+    constexpr uint8_t SCREEN_STATE_MAIN_PAGE =      0x3F;
+    constexpr uint8_t SCREEN_STATE_HISTORY =        0x40;
+
+    typedef enum screenWidget : uint8_t {SCREEN_WIDGET_ROOM_ID, SCREEN_WIDGET_TEMPERATURE, SCREEN_WIDGET_HUMIDITY, SCREEN_WIDGET_WIFI, SCREEN_WIDGET_UPDATE, SCREEN_WIDGET_COUNT} screenWidget_t;
+
+    /**
+     * @brief Layout of a single widget.
+     */
+    struct ScreenWidgetLayout {
+        screenWidget_t widget;                                      /**< Widget described, equal to the index into the layout. */
+        uint8_t bounds[4];                                          /**< Pixels touched without shift, as {x, y, w, h}. */
+        uint8_t tileArea[4];                                        /**< Area cleared and sent when redrawn, as {tx, ty, tw, th}. */
+        uint8_t states;                                             /**< Fields of the state the widget depends on. */
+    };
+
+    constexpr ScreenWidgetLayout layoutMainPage[] = {
+        {SCREEN_WIDGET_ROOM_ID,     {100, 0, 21, 21},   {12, 0, 4, 3},  SCREEN_STATE_ROOM_NUMBER | SCREEN_STATE_OFFSET},
+        {SCREEN_WIDGET_TEMPERATURE, {12, 0, 76, 16},    {1, 0, 11, 2},  SCREEN_STATE_TEMPERATURE | SCREEN_STATE_OFFSET},
+        {SCREEN_WIDGET_HUMIDITY,    {12, 16, 76, 16},   {1, 2, 11, 2},  SCREEN_STATE_HUMIDITY | SCREEN_STATE_OFFSET},
+        {SCREEN_WIDGET_WIFI,        {120, 24, 8, 8},    {14, 3, 2, 1},  SCREEN_STATE_CONNECTION | SCREEN_STATE_OFFSET},
+        {SCREEN_WIDGET_UPDATE,      {110, 24, 8, 8},    {13, 3, 2, 1},  SCREEN_STATE_UPDATE | SCREEN_STATE_OFFSET}
+    };
+
+    constexpr int8_t screenLayoutOffsetMinimum() {
+        int8_t minimum = 0;
+        for (int8_t offset : offsetsBurnIn) {
+            minimum = (offset < minimum) ? offset : minimum;
+        }
+
+        return minimum;
+    }
+
+    constexpr int8_t screenLayoutOffsetMaximum() {
+        int8_t maximum = 0;
+        for (int8_t offset : offsetsBurnIn) {
+            maximum = (offset > maximum) ? offset : maximum;
+        }
+
+        return maximum;
+    }
+
+    constexpr bool screenLayoutIsValid(const ScreenWidgetLayout &layout, uint8_t index) {
+        return layout.widget == index
+            && layout.states != 0
+            && (layout.tileArea[0] + layout.tileArea[2]) <= widthDisplayTiles
+            && (layout.tileArea[1] + layout.tileArea[3]) <= heightDisplayTiles
+            && (layout.bounds[0] + screenLayoutOffsetMinimum()) >= (layout.tileArea[0] * 8)
+            && (layout.bounds[0] + layout.bounds[2] + screenLayoutOffsetMaximum()) <= ((layout.tileArea[0] + layout.tileArea[2]) * 8)
+            && layout.bounds[1] >= (layout.tileArea[1] * 8)
+            && (layout.bounds[1] + layout.bounds[3]) <= ((layout.tileArea[1] + layout.tileArea[3]) * 8);
+    }
+
+    constexpr bool screenLayoutIsValid() {
+        for (uint8_t i = 0; i < SCREEN_WIDGET_COUNT; i++) {
+            if (!screenLayoutIsValid(layoutMainPage[i], i)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    constexpr bool screenLayoutAreOverlapping(const ScreenWidgetLayout &first, const ScreenWidgetLayout &second) {
+        return first.tileArea[0] < (second.tileArea[0] + second.tileArea[2])
+            && second.tileArea[0] < (first.tileArea[0] + first.tileArea[2])
+            && first.tileArea[1] < (second.tileArea[1] + second.tileArea[3])
+            && second.tileArea[1] < (first.tileArea[1] + first.tileArea[3]);
+    }
+
+    /**
+     * @brief Gets the widgets to redraw with a given one: clearing an area erases the widgets overlapping it, which
+     *  in turn erase theirs.
+     */
+    constexpr uint8_t screenLayoutRedrawMask(uint8_t widget) {
+        uint8_t mask = 1 << widget;
+        for (uint8_t pass = 0; pass < SCREEN_WIDGET_COUNT; pass++) {
+            for (uint8_t i = 0; i < SCREEN_WIDGET_COUNT; i++) {
+                for (uint8_t j = 0; j < SCREEN_WIDGET_COUNT; j++) {
+                    if ((mask & (1 << i)) && screenLayoutAreOverlapping(layoutMainPage[i], layoutMainPage[j])) {
+                        mask |= 1 << j;
+                    }
+                }
+            }
+        }
+
+        return mask;
+    }
+
+    /**
+     * @brief Widgets to redraw with each widget of the main page, computed by the compiler.
+     */
+    struct ScreenLayoutRedraw {
+        uint8_t masks[SCREEN_WIDGET_COUNT];
+
+        constexpr ScreenLayoutRedraw() : masks() {
+            for (uint8_t i = 0; i < SCREEN_WIDGET_COUNT; i++) {
+                masks[i] = screenLayoutRedrawMask(i);
+            }
+        }
+    };
+
+    constexpr ScreenLayoutRedraw layoutRedrawMainPage;
+
+    static_assert(sizeof(layoutMainPage) / sizeof(layoutMainPage[0]) == SCREEN_WIDGET_COUNT, "Every widget of the main page must have its layout.");
+    static_assert(SCREEN_WIDGET_COUNT <= 8, "The masks of the widgets are 8 bit wide.");
+    static_assert(screenLayoutIsValid(), "A widget of the main page is out of order, unbound, or out of its area for some shift of the burn-in protection.");
+
+#endif // SCREENLAYOUT_H
@@ -1,72 +1,154 @@
 #include "Sensor.h"
 
-Sensor::Sensor(uint8_t pin, uint8_t type) {
-    sensorDHT = new DHT(pin, type);
-    sensorHDC = nullptr;
+Sensor::Sensor() {
+    devicesCount = 0;
 
     temperature = 0;
     humidity = 0;
 
-    endTimeoutHDC = 0;
+    isConverting = false;
+    endTimeoutCycle = 0;
+    endTimeoutConversion = 0;
 }
 
-Sensor::Sensor(uint8_t address, HDC1080_MeasurementResolution humidityResolution, HDC1080_MeasurementResolution temperatureResolution) {
-    sensorDHT = nullptr;
-    sensorHDC = new ClosedCube_HDC1080();
+Sensor::Sensor(uint8_t pin, uint8_t type) : Sensor() { addDevice(new SensorDeviceDHT(pin, type)); }
 
-    this->address = address;
-    this->humidityResolution = humidityResolution;
-    this->temperatureResolution = temperatureResolution;
+Sensor::Sensor(uint8_t address, HDC1080_MeasurementResolution humidityResolution, HDC1080_MeasurementResolution temperatureResolution) : Sensor() {
+    addDevice(new SensorDeviceHDC1080(address, humidityResolution, temperatureResolution));
+}
 
-    temperature = 0;
-    humidity = 0;
+bool Sensor::addDevice(SensorDevice *device) {
+    if (devicesCount == SENSOR_MAX_DEVICES || device == nullptr) {
+        Serial.println("\033[1;91m[SENSOR ERROR: DEVICE NOT ADDED]\033[0m");
+        return false;
+    }
+
+    devices[devicesCount] = device;
+    isTriggered[devicesCount] = false;
+    devicesCount++;
+
+    return true;
 }
 
-void Sensor::begin() { 
-    if (sensorDHT != nullptr) {
-        sensorDHT->begin();
-    } else if (sensorHDC != nullptr) {
-        sensorHDC->begin(address);
-        sensorHDC->setResolution(humidityResolution, temperatureResolution);
+uint8_t Sensor::getDevicesCount() const { return devicesCount; }
+
+SensorDevice* Sensor::getDevice(uint8_t index) const { return index < devicesCount ? devices[index] : nullptr; }
+
+const SensorTelemetry& Sensor::getTelemetry(uint8_t index) const { return telemetry[index]; }
+
+void Sensor::begin() {
+    for (uint8_t i = 0; i < devicesCount; i++) {
+        if (!devices[i]->begin()) {
+            Serial.println("\033[1;91m[SENSOR ERROR: DEVICE " + String(i) + " NOT FOUND]\033[0m");
+        }
     }
 }
 
 bool Sensor::check() {
-    bool changed = false;
+    /*
+     * There is a case where "timeout" will go to overflow and the result of "millis()" not.
+     * The signed difference keeps the comparison right in this case, too.
+     */
+    if (!isConverting) {
+        if (static_cast<long>(endTimeoutCycle - millis()) <= 0) {
+            endTimeoutCycle = millis() + TIMEOUT_READ_CYCLE;
+            trigger();
+        }
+
+        return false;
+    }
+
+    if (static_cast<long>(endTimeoutConversion - millis()) <= 0) {
+        isConverting = false;
+        return collect();
+    }
+
+    return false;
+}
 
-    if (sensorDHT != nullptr) {
-        if (checkTemperature(sensorDHT->readTemperature()) || checkHumidity(sensorDHT->readHumidity())) {
-            changed = true;
-        } else {
-            changed = false;
+unsigned long Sensor::getTimeToNextCheck() {
+    const long remaining = static_cast<long>((isConverting ? endTimeoutConversion : endTimeoutCycle) - millis());
+
+    return (remaining > 0) ? static_cast<unsigned long>(remaining) : 0;
+}
+
+void Sensor::trigger() {
+    uint16_t conversionTime = 0;
+
+    /* Starting the conversion of every device at the same time, so their waits overlap. */
+    for (uint8_t i = 0; i < devicesCount; i++) {
+        isTriggered[i] = devices[i]->trigger();
+        if (!isTriggered[i]) {
+            telemetry[i].recordFailure(millis());
         }
-    } else if (sensorHDC != nullptr) {
-        /* 
-         * There is a case where "timeout" will go to overflow and the result of "millis()" not. 
-         * In this case the sensor will be read every time until the result of "millis()" will go to overflow, too. 
-         */
-        if (static_cast<long>(endTimeoutHDC - millis()) <= 0) {
-            endTimeoutHDC = millis() + TIMEOUT_READ_HDC;
-
-            if (checkTemperature(sensorHDC->readTemperature()) || checkHumidity(sensorHDC->readHumidity())) {
-                changed = true;
-            } else {
-                changed = false;
-            }
 
-        } else {
-            changed = false;
+        if (isTriggered[i] && devices[i]->getConversionTime() > conversionTime) {
+            conversionTime = devices[i]->getConversionTime();
         }
     }
 
-    if (changed) {
-        if ((getTemperature() >= 1) && (getHumidity() >= 1) && (getTemperature() <= 124) && (getHumidity() <= 99)) {
-            notify();
-            return true;
+    endTimeoutConversion = millis() + conversionTime;
+    isConverting = true;
+}
+
+bool Sensor::collect() {
+    double sumTemperature = 0;
+    double sumHumidity = 0;
+    uint8_t countTemperature = 0;
+    uint8_t countHumidity = 0;
+
+    /* Collecting the results of every device in a single pass. */
+    for (uint8_t i = 0; i < devicesCount; i++) {
+        if (!isTriggered[i]) {
+            continue;
         }
 
-        Serial.println("\033[1;91m[SENSOR ERROR]\033[0m");
-        return false;
+        const unsigned long timeStartedRead = micros();
+        if (!devices[i]->collect()) {
+            telemetry[i].recordFailure(millis());
+            continue;
+        }
+
+        const uint8_t changedChannels = devices[i]->takeChangedChannels();
+        telemetry[i].recordRead(micros() - timeStartedRead, changedChannels != 0, millis());
+        for (uint8_t q = 0; q < SENSOR_QUANTITY_COUNT; q++) {
+            const sensorQuantity_t quantity = static_cast<sensorQuantity_t>(q);
+            if (!devices[i]->hasQuantity(quantity)) {
+                continue;
+            }
+
+            const double value = devices[i]->getValue(quantity);
+            if ((value < SENSOR_RANGE_MIN[q]) || (value > SENSOR_RANGE_MAX[q])) {
+                telemetry[i].recordRejection();
+                Serial.println("\033[1;91m[SENSOR ERROR]\033[0m");
+                continue;
+            }
+
+            if (quantity == SENSOR_QUANTITY_TEMPERATURE) {
+                sumTemperature += value;
+                countTemperature++;
+            } else if (quantity == SENSOR_QUANTITY_HUMIDITY) {
+                sumHumidity += value;
+                countHumidity++;
+            }
+
+            if (changedChannels & (1 << q)) {
+                observers.notifyReading({i, quantity, value});
+            }
+        }
+    }
+
+    bool changed = false;
+    if (countTemperature > 0) {
+        changed |= checkTemperature(sumTemperature / countTemperature);
+    }
+    if (countHumidity > 0) {
+        changed |= checkHumidity(sumHumidity / countHumidity);
+    }
+
+    if (changed) {
+        notify();
+        return true;
     }
 
     return false;
@@ -94,15 +176,18 @@ bool Sensor::checkHumidity(double humidity) {
     return false;
 }
 
-void Sensor::addObserver(SensorObserver* observer) { observers.push_back(observer); }
+void Sensor::addObserver(SensorObserver* observer) {
+    if (!observers.add(observer)) {
+        Serial.println("\033[1;91m[SENSOR ERROR: OBSERVER NOT ADDED]\033[0m");
+    }
+}
+
+void Sensor::addObserver(SensorObserver* observer, const SensorSubscription &subscription) {
+    if (!observers.add(observer, subscription)) {
+        Serial.println("\033[1;91m[SENSOR ERROR: OBSERVER NOT ADDED]\033[0m");
+    }
+}
 
 void Sensor::removeObserver(SensorObserver* observer) { observers.remove(observer); }
 
-void Sensor::notify() {
-    std::list<SensorObserver* >::iterator iteratorObservers = observers.begin();
-    
-    while (iteratorObservers != observers.end()) {
-        (*iteratorObservers)->update(temperature, humidity);
-        ++iteratorObservers;
-    }
-}
\ No newline at end of file
+void Sensor::notify() { observers.notify(temperature, humidity, millis()); }
\ No newline at end of file
@@ -2,7 +2,9 @@
  * @file Sensor.h
  * @brief Provides functionality to manage sensors for the Air Analyzer system.
  *
- * This library supports both DHT and HDC sensor types, allowing the system to monitor temperature and humidity.
+ * This library keeps a registry of devices (DHT, HDC1080 or any other SensorDevice), allowing the system to monitor
+ * temperature, humidity and further quantities such as CO2 or pressure. The conversions of all devices are started
+ * together and collected in a single pass, so adding devices does not add their waits to the loop.
  * The Sensor class acts as a subject, notifying observers when new data is available via the check method.
  *
  * Copyright (c) 2025 Davide Palladino.
@@ -11,35 +13,45 @@
  * @author Davide Palladino
  * @contact davidepalladino@hotmail.com
  * @website https://davidepalladino.github.io/
- * @version 3.0.0
- * @date 29th January 2025
+ * @version 4.1.0
+ * @date 18th October 2026
  */
 
 #ifndef SENSOR_H
     #define SENSOR_H
 
     #include <Arduino.h>
-    #include <DHT.h>
-    #include <DHT_U.h>
     #include <ClosedCube_HDC1080.h>
     #include <SensorObserver.h>
-    #include <list>
 
     #include "SensorSubject.h"
+    #include "SensorObserverRegistry.h"
+    #include "SensorDevice.h"
+    #include "SensorDeviceDHT.h"
+    #include "SensorDeviceHDC1080.h"
+    #include "SensorTelemetry.h"
     #include "SensorConsts.h"
 
     /**
      * @class Sensor
      * @brief Manages temperature and humidity sensors, providing data to observers.
      *
-     * The Sensor class supports DHT and HDC sensor types and acts as a subject in an observer pattern.
+     * The Sensor class holds up to `SENSOR_MAX_DEVICES` devices and acts as a subject in an observer pattern.
+     * Temperature and humidity delivered to `update()` are the average of the valid readings of all devices.
      */
     class Sensor : public SensorSubject {
         friend class Screen;
         friend class ApiManagement;
 
         public:
-        /**
+            /**
+             * @brief Constructs a Sensor object without devices.
+             *
+             * Devices must be added with `addDevice()` before calling `begin()`.
+             */
+            Sensor();
+
+            /**
              * @brief Constructs a Sensor object using a DHT sensor type.
              *
              * @param pin The GPIO pin where the DHT sensor is connected.
@@ -57,7 +69,39 @@
             Sensor(uint8_t address, HDC1080_MeasurementResolution humidityResolution, HDC1080_MeasurementResolution temperatureResolution);
 
             /**
-             * @brief Initializes the sensor hardware.
+             * @brief Adds a device to the registry.
+             *
+             * @param device Pointer to the device object to be added.
+             * @return True if the device has been added, false if the registry is full.
+             */
+            bool addDevice(SensorDevice *device);
+
+            /**
+             * @brief Gets the number of devices in the registry.
+             *
+             * @return The number of devices.
+             */
+            uint8_t getDevicesCount() const;
+
+            /**
+             * @brief Gets a device of the registry.
+             *
+             * @param index The index of the device, in order of addition.
+             * @return Pointer to the device, or `nullptr` if the index is not valid.
+             */
+            SensorDevice* getDevice(uint8_t index) const;
+
+            /**
+             * @brief Gets the health and timing counters of a device.
+             *
+             * @param index The index of the device, in order of addition.
+             * @return Reference to the counters of the device.
+             * @warning The index must be lower than `getDevicesCount()`.
+             */
+            const SensorTelemetry& getTelemetry(uint8_t index) const;
+
+            /**
+             * @brief Initializes the hardware of every device.
              *
              * This method should be called before collecting sensor data.
              */
@@ -66,10 +110,20 @@
             /**
              * @brief Checks for changes in temperature or humidity and notifies observers if a significant variation is detected.
              *
+             * Every call is non-blocking: a cycle first triggers the conversion of all devices and, once the longest
+             *  conversion time has elapsed, collects all results in a single pass.
+             *
              * @return True if a variation is detected, false otherwise.
              */
             bool check();
 
+            /**
+             * @brief Gets the time until `check()` has some work to do, to call it only then.
+             *
+             * @return The time in milliseconds, 0 if the work is already due.
+             */
+            unsigned long getTimeToNextCheck();
+
             /**
              * @brief Retrieves the last recorded temperature value.
              *
@@ -87,10 +141,38 @@
             /**
              * @brief Adds an observer to the list of observers.
              *
+             * The observer will be notified through its virtual `update()`.
+             *
              * @param observer Pointer to the observer object to be added.
              */
             void addObserver(SensorObserver* observer) override;
 
+            /**
+             * @brief Adds an observer to the list of observers, with its own subscription.
+             *
+             * The observer will be notified through its virtual `update()`.
+             *
+             * @param observer Pointer to the observer object to be added.
+             * @param subscription Minimum interval, resolution and channels that wake the observer.
+             */
+            void addObserver(SensorObserver* observer, const SensorSubscription &subscription) override;
+
+            /**
+             * @brief Adds an observer of a known type to the list of observers.
+             *
+             * The observer is bound at compile time, so its `update()` is called without the virtual table.
+             *
+             * @tparam T The concrete type of the observer (e.g., Screen, ApiManagement).
+             * @param observer Pointer to the observer object to be added.
+             * @param subscription Minimum interval, resolution and channels that wake the observer.
+             */
+            template <typename T>
+            void addObserver(T* observer, const SensorSubscription &subscription = SENSOR_SUBSCRIPTION_DEFAULT) {
+                if (!observers.add(observer, subscription)) {
+                    Serial.println("\033[1;91m[SENSOR ERROR: OBSERVER NOT ADDED]\033[0m");
+                }
+            }
+
             /**
              * @brief Removes an observer from the list of observers.
              *
@@ -99,15 +181,26 @@
             void removeObserver(SensorObserver* observer) override;
 
         private:
-            std::list<SensorObserver*> observers;                       /**< List of observer objects that get notified on data changes. */
-            DHT *sensorDHT;                                             /**< Pointer to an instance of a DHT sensor object. */
-            ClosedCube_HDC1080 *sensorHDC;                              /**< Pointer to an instance of an HDC sensor object. */
-            uint8_t address;                                            /**< I2C address of the HDC sensor. */
-            HDC1080_MeasurementResolution humidityResolution;           /**< Humidity resolution setting. */
-            HDC1080_MeasurementResolution temperatureResolution;        /**< Temperature resolution setting. */
+            SensorObserverRegistry<SENSOR_MAX_OBSERVERS> observers;     /**< Observer objects that get notified on data changes. */
+            SensorDevice *devices[SENSOR_MAX_DEVICES];                  /**< Devices of the registry. */
+            bool isTriggered[SENSOR_MAX_DEVICES];                       /**< Flags to indicate which devices started the actual conversion. */
+            SensorTelemetry telemetry[SENSOR_MAX_DEVICES];              /**< Health and timing counters of the devices. */
+            uint8_t devicesCount;                                       /**< Number of devices in the registry. */
             double temperature;                                         /**< Last recorded temperature value. */
             double humidity;                                            /**< Last recorded humidity value. */
-            unsigned long endTimeoutHDC;                                /**< Timeout marker for HDC sensor readings to prevent frequent updates. */
+            bool isConverting;                                          /**< Flag to indicate if the devices are converting. */
+            unsigned long endTimeoutCycle;                              /**< Timeout marker for the next cycle, to prevent frequent updates. */
+            unsigned long endTimeoutConversion;                         /**< Timeout marker for collecting the results of the conversion. */
+
+            /** @brief Starts the conversion of every device. */
+            void trigger();
+
+            /**
+             * @brief Collects the results of every device in a single pass and notifies the observers.
+             *
+             * @return True if a variation is detected, false otherwise.
+             */
+            bool collect();
 
             /**
              * @brief Compares current and previous temperature values to detect changes.
@@ -126,7 +219,7 @@
             bool checkHumidity(double humidity);
 
             /**
-             * @brief Notifies all registered observers of data updates.
+             * @brief Notifies the registered observers whose subscription is satisfied by the data updates.
              */
             void notify() override;
     };
@@ -1,4 +1,26 @@
 #ifndef SENSORCONSTS_H
     #define SENSORCONSTS_H
-    constexpr uint16_t TIMEOUT_READ_HDC = 1000;
+    constexpr uint16_t TIMEOUT_READ_CYCLE = 1000;               // Time in milliseconds between two conversions of the devices.
+    constexpr uint8_t SENSOR_MAX_OBSERVERS = 4;                 // Capacity of the observer registry, allocated inline.
+    constexpr uint8_t SENSOR_MAX_DEVICES = 4;                   // Capacity of the device registry, allocated inline.
+
+    // Valid ranges, in order of quantity: temperature (°C), humidity (%), CO2 (ppm), pressure (hPa).
+    constexpr double SENSOR_RANGE_MIN[4] =                      {1, 1, 250, 300};
+    constexpr double SENSOR_RANGE_MAX[4] =                      {124, 99, 10000, 1100};
+
+    // Telemetry
+    constexpr uint8_t SENSOR_TELEMETRY_HISTOGRAM_BUCKETS =      8;
+    constexpr uint32_t SENSOR_TELEMETRY_HISTOGRAM_FIRST =       128;        // Microseconds, upper limit of the first bucket.
+    constexpr uint16_t SENSOR_TELEMETRY_STUCK_SAMPLES =         600;        // Consecutive reads without changes, about 10 minutes.
+
+    // HDC1080
+    constexpr uint8_t HDC1080_REGISTER_TEMPERATURE =            0x00;
+    constexpr uint8_t HDC1080_REGISTER_CONFIGURATION =          0x02;
+    constexpr uint8_t HDC1080_CONFIGURATION_MODE_BOTH =         0x10;       // MSB of configuration, temperature and humidity in sequence.
+    constexpr uint8_t HDC1080_CONFIGURATION_TEMPERATURE_11BIT = 0x04;
+    constexpr uint8_t HDC1080_CONFIGURATION_HUMIDITY_11BIT =    0x01;
+    constexpr uint8_t HDC1080_CONFIGURATION_HUMIDITY_8BIT =     0x02;
+    constexpr uint8_t HDC1080_CONVERSION_TIME_8BIT =            3;          // Milliseconds, rounded up from the datasheet.
+    constexpr uint8_t HDC1080_CONVERSION_TIME_11BIT =           4;
+    constexpr uint8_t HDC1080_CONVERSION_TIME_14BIT =           7;
 #endif // SENSORCONSTS_H
@@ -0,0 +1,30 @@
+#include "SensorDevice.h"
+
+SensorDevice::SensorDevice(uint8_t channels) {
+    this->channels = channels;
+    this->changedChannels = 0;
+
+    for (double &value : values) {
+        value = 0;
+    }
+}
+
+uint8_t SensorDevice::getChannels() const { return channels; }
+
+bool SensorDevice::hasQuantity(sensorQuantity_t quantity) const { return (channels & (1 << quantity)) != 0; }
+
+double SensorDevice::getValue(sensorQuantity_t quantity) const { return values[quantity]; }
+
+uint8_t SensorDevice::takeChangedChannels() {
+    const uint8_t changed = changedChannels;
+    changedChannels = 0;
+
+    return changed;
+}
+
+void SensorDevice::setValue(sensorQuantity_t quantity, double value) {
+    if (values[quantity] != value) {
+        values[quantity] = value;
+        changedChannels |= (1 << quantity);
+    }
+}
@@ -0,0 +1,130 @@
+/**
+ * @file SensorDevice.h
+ * @brief Provides the interface of a single physical unit managed by the Sensor registry.
+ *
+ * A device provides one or more quantities (e.g., temperature and humidity) and splits every reading in two phases:
+ * `trigger()` starts the conversion and `collect()` reads its result. In this way the Sensor class can start
+ * the conversion of every device at once and collect all results in a single pass, without waiting for each one.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef SENSORDEVICE_H
+    #define SENSORDEVICE_H
+
+    #include <Arduino.h>
+
+    #include "SensorSubscription.h"
+
+    typedef enum sensorQuantity : uint8_t {SENSOR_QUANTITY_TEMPERATURE, SENSOR_QUANTITY_HUMIDITY, SENSOR_QUANTITY_CO2, SENSOR_QUANTITY_PRESSURE, SENSOR_QUANTITY_COUNT} sensorQuantity_t;
+
+    static_assert((1 << SENSOR_QUANTITY_TEMPERATURE) == SENSOR_CHANNEL_TEMPERATURE, "Channel and quantity of temperature must match.");
+    static_assert((1 << SENSOR_QUANTITY_HUMIDITY) == SENSOR_CHANNEL_HUMIDITY, "Channel and quantity of humidity must match.");
+    static_assert((1 << SENSOR_QUANTITY_CO2) == SENSOR_CHANNEL_CO2, "Channel and quantity of CO2 must match.");
+    static_assert((1 << SENSOR_QUANTITY_PRESSURE) == SENSOR_CHANNEL_PRESSURE, "Channel and quantity of pressure must match.");
+
+    /**
+     * @brief Single value read by a device.
+     */
+    struct SensorReading {
+        uint8_t device;                         /**< Index of the device in the Sensor registry. */
+        sensorQuantity_t quantity;              /**< Quantity of the value. */
+        double value;                           /**< Value read (°C, %, ppm or hPa). */
+    };
+
+    /**
+     * @class SensorDevice
+     * @brief Base class for every physical unit, storing the last value of each quantity it provides.
+     */
+    class SensorDevice {
+        public:
+            /**
+             * @brief Constructs a SensorDevice object.
+             *
+             * @param channels Bitmask of the quantities provided (e.g., "SENSOR_CHANNEL_TEMPERATURE | SENSOR_CHANNEL_HUMIDITY").
+             */
+            explicit SensorDevice(uint8_t channels);
+
+            /**
+             * @brief Initializes the hardware of the device.
+             *
+             * @return True if the device answered, false otherwise.
+             */
+            virtual bool begin() = 0;
+
+            /**
+             * @brief Starts a new conversion, without waiting for its result.
+             *
+             * @return True if the conversion has been started, false otherwise (e.g., NACK on the bus).
+             */
+            virtual bool trigger() = 0;
+
+            /**
+             * @brief Gets the time needed by the device to complete a conversion started by `trigger()`.
+             *
+             * @return The time in milliseconds.
+             */
+            virtual uint16_t getConversionTime() = 0;
+
+            /**
+             * @brief Reads the result of the last conversion, storing the values.
+             *
+             * @return True if the values have been read, false otherwise.
+             */
+            virtual bool collect() = 0;
+
+            /**
+             * @brief Gets the bitmask of the quantities provided.
+             *
+             * @return The bitmask of the channels.
+             */
+            uint8_t getChannels() const;
+
+            /**
+             * @brief Checks if the device provides a quantity.
+             *
+             * @param quantity The quantity to check.
+             * @return True if the quantity is provided, false otherwise.
+             */
+            bool hasQuantity(sensorQuantity_t quantity) const;
+
+            /**
+             * @brief Gets the last value read for a quantity.
+             *
+             * @param quantity The quantity to get.
+             * @return The last value read.
+             */
+            double getValue(sensorQuantity_t quantity) const;
+
+            /**
+             * @brief Gets and resets the bitmask of the quantities changed since the last call.
+             *
+             * @return The bitmask of the channels changed.
+             */
+            uint8_t takeChangedChannels();
+
+            virtual ~SensorDevice() = default;
+
+        protected:
+            /**
+             * @brief Stores the value of a quantity, marking it as changed if it differs from the previous one.
+             *
+             * @param quantity The quantity to set.
+             * @param value The value read.
+             */
+            void setValue(sensorQuantity_t quantity, double value);
+
+        private:
+            uint8_t channels;                                   /**< Bitmask of the quantities provided. */
+            uint8_t changedChannels;                            /**< Bitmask of the quantities changed since the last check. */
+            double values[SENSOR_QUANTITY_COUNT];               /**< Last value of each quantity. */
+    };
+
+#endif // SENSORDEVICE_H
@@ -0,0 +1,27 @@
+#include "SensorDeviceDHT.h"
+
+SensorDeviceDHT::SensorDeviceDHT(uint8_t pin, uint8_t type) : SensorDevice(SENSOR_CHANNEL_TEMPERATURE | SENSOR_CHANNEL_HUMIDITY), sensorDHT(pin, type) { }
+
+bool SensorDeviceDHT::begin() {
+    sensorDHT.begin();
+
+    return true;
+}
+
+bool SensorDeviceDHT::trigger() { return true; }
+
+uint16_t SensorDeviceDHT::getConversionTime() { return 0; }
+
+bool SensorDeviceDHT::collect() {
+    const float temperature = sensorDHT.readTemperature();
+    const float humidity = sensorDHT.readHumidity();
+
+    if (isnan(temperature) || isnan(humidity)) {
+        return false;
+    }
+
+    setValue(SENSOR_QUANTITY_TEMPERATURE, temperature);
+    setValue(SENSOR_QUANTITY_HUMIDITY, humidity);
+
+    return true;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file SensorDeviceDHT.h
+ * @brief Provides the DHT temperature and humidity device for the Sensor registry.
+ *
+ * The DHT family is not on the I2C bus and converts when it is read, so the trigger phase has nothing to do.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef SENSORDEVICEDHT_H
+    #define SENSORDEVICEDHT_H
+
+    #include <Arduino.h>
+    #include <DHT.h>
+    #include <DHT_U.h>
+
+    #include "SensorDevice.h"
+
+    /**
+     * @class SensorDeviceDHT
+     * @brief Reads temperature and humidity from a DHT sensor.
+     */
+    class SensorDeviceDHT : public SensorDevice {
+        public:
+            /**
+             * @brief Constructs a SensorDeviceDHT object.
+             *
+             * @param pin The GPIO pin where the DHT sensor is connected.
+             * @param type The sensor type (e.g., DHT11, DHT22, AM2301).
+             */
+            SensorDeviceDHT(uint8_t pin, uint8_t type);
+
+            bool begin() override;
+            bool trigger() override;
+            uint16_t getConversionTime() override;
+            bool collect() override;
+
+        private:
+            DHT sensorDHT;                                              /**< Instance of a DHT sensor object. */
+    };
+
+#endif // SENSORDEVICEDHT_H
@@ -0,0 +1,72 @@
+#include "SensorDeviceHDC1080.h"
+
+SensorDeviceHDC1080::SensorDeviceHDC1080(uint8_t address, HDC1080_MeasurementResolution humidityResolution, HDC1080_MeasurementResolution temperatureResolution) : SensorDevice(SENSOR_CHANNEL_TEMPERATURE | SENSOR_CHANNEL_HUMIDITY) {
+    this->address = address;
+    this->humidityResolution = humidityResolution;
+    this->temperatureResolution = temperatureResolution;
+}
+
+bool SensorDeviceHDC1080::begin() {
+    /* Configuration register: acquisition of both quantities in sequence, with the requested resolutions. */
+    uint8_t configuration = HDC1080_CONFIGURATION_MODE_BOTH;
+
+    if (temperatureResolution == HDC1080_RESOLUTION_11BIT) {
+        configuration |= HDC1080_CONFIGURATION_TEMPERATURE_11BIT;
+    }
+
+    if (humidityResolution == HDC1080_RESOLUTION_11BIT) {
+        configuration |= HDC1080_CONFIGURATION_HUMIDITY_11BIT;
+    } else if (humidityResolution == HDC1080_RESOLUTION_8BIT) {
+        configuration |= HDC1080_CONFIGURATION_HUMIDITY_8BIT;
+    }
+
+    Wire.begin();
+    Wire.beginTransmission(address);
+    Wire.write(HDC1080_REGISTER_CONFIGURATION);
+    Wire.write(configuration);
+    Wire.write(static_cast<uint8_t>(0x00));
+
+    return Wire.endTransmission() == 0;
+}
+
+bool SensorDeviceHDC1080::trigger() {
+    Wire.beginTransmission(address);
+    Wire.write(HDC1080_REGISTER_TEMPERATURE);
+
+    return Wire.endTransmission() == 0;
+}
+
+uint16_t SensorDeviceHDC1080::getConversionTime() {
+    uint16_t conversionTime = (temperatureResolution == HDC1080_RESOLUTION_11BIT) ? HDC1080_CONVERSION_TIME_11BIT : HDC1080_CONVERSION_TIME_14BIT;
+
+    switch (humidityResolution) {
+        case HDC1080_RESOLUTION_8BIT:
+            conversionTime += HDC1080_CONVERSION_TIME_8BIT;
+            break;
+        case HDC1080_RESOLUTION_11BIT:
+            conversionTime += HDC1080_CONVERSION_TIME_11BIT;
+            break;
+        default:
+            conversionTime += HDC1080_CONVERSION_TIME_14BIT;
+            break;
+    }
+
+    return conversionTime;
+}
+
+bool SensorDeviceHDC1080::collect() {
+    /* The device answers with NACK while the conversion is still running. */
+    if (Wire.requestFrom(address, static_cast<uint8_t>(4)) != 4) {
+        return false;
+    }
+
+    uint16_t rawTemperature = Wire.read() << 8;
+    rawTemperature |= Wire.read();
+    uint16_t rawHumidity = Wire.read() << 8;
+    rawHumidity |= Wire.read();
+
+    setValue(SENSOR_QUANTITY_TEMPERATURE, (rawTemperature / 65536.0) * 165.0 - 40.0);
+    setValue(SENSOR_QUANTITY_HUMIDITY, (rawHumidity / 65536.0) * 100.0);
+
+    return true;
+}
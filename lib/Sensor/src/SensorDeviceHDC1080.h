@@ -0,0 +1,54 @@
+/**
+ * @file SensorDeviceHDC1080.h
+ * @brief Provides the HDC1080 temperature and humidity device for the Sensor registry.
+ *
+ * The device is driven directly on the I2C bus in "acquisition of both" mode: a single trigger converts temperature
+ * and humidity, and a single read of four bytes collects both, instead of two blocking reads with their own waits.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef SENSORDEVICEHDC1080_H
+    #define SENSORDEVICEHDC1080_H
+
+    #include <Arduino.h>
+    #include <Wire.h>
+    #include <ClosedCube_HDC1080.h>
+
+    #include "SensorDevice.h"
+    #include "SensorConsts.h"
+
+    /**
+     * @class SensorDeviceHDC1080
+     * @brief Reads temperature and humidity from an HDC1080 with a split trigger and collect.
+     */
+    class SensorDeviceHDC1080 : public SensorDevice {
+        public:
+            /**
+             * @brief Constructs a SensorDeviceHDC1080 object.
+             *
+             * @param address The I2C address of the HDC sensor.
+             * @param humidityResolution Humidity measurement resolution setting.
+             * @param temperatureResolution Temperature measurement resolution setting.
+             */
+            SensorDeviceHDC1080(uint8_t address, HDC1080_MeasurementResolution humidityResolution, HDC1080_MeasurementResolution temperatureResolution);
+
+            bool begin() override;
+            bool trigger() override;
+            uint16_t getConversionTime() override;
+            bool collect() override;
+
+        private:
+            uint8_t address;                                            /**< I2C address of the HDC sensor. */
+            HDC1080_MeasurementResolution humidityResolution;           /**< Humidity resolution setting. */
+            HDC1080_MeasurementResolution temperatureResolution;        /**< Temperature resolution setting. */
+    };
+
+#endif // SENSORDEVICEHDC1080_H
@@ -3,9 +3,12 @@
 
     #include <Arduino.h>
 
+    struct SensorReading;
+
     class SensorObserver {
         public:
             virtual void update(double temperature, double humidity) = 0;
+            virtual void updateReading(const SensorReading &reading) { }
             virtual ~SensorObserver() = default;
     };
 #endif
\ No newline at end of file
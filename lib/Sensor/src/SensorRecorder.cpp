@@ -0,0 +1,35 @@
+#include "SensorRecorder.h"
+
+SensorRecorder::SensorRecorder(Print &output, sensorTraceFormat_t format) : output(output), format(format), records(0) { }
+
+void SensorRecorder::begin() {
+    if (format == SENSOR_TRACE_BINARY) {
+        output.write(reinterpret_cast<const uint8_t *>(SENSOR_TRACE_MAGIC), sizeof(SENSOR_TRACE_MAGIC));
+    }
+}
+
+uint32_t SensorRecorder::getRecords() const { return records; }
+
+void SensorRecorder::update(double temperature, double humidity) {
+    const uint32_t timestamp = millis();
+
+    if (format == SENSOR_TRACE_BINARY) {
+        const int16_t rawTemperature = static_cast<int16_t>(lround(temperature * 100));
+        const uint16_t rawHumidity = static_cast<uint16_t>(lround(humidity * 100));
+
+        const uint8_t record[SENSOR_TRACE_SIZE_RECORD] = {
+            static_cast<uint8_t>(timestamp), static_cast<uint8_t>(timestamp >> 8), static_cast<uint8_t>(timestamp >> 16), static_cast<uint8_t>(timestamp >> 24),
+            static_cast<uint8_t>(rawTemperature), static_cast<uint8_t>(rawTemperature >> 8),
+            static_cast<uint8_t>(rawHumidity), static_cast<uint8_t>(rawHumidity >> 8)
+        };
+        output.write(record, SENSOR_TRACE_SIZE_RECORD);
+    } else {
+        output.print(timestamp);
+        output.print(',');
+        output.print(temperature, 2);
+        output.print(',');
+        output.println(humidity, 2);
+    }
+
+    records++;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file SensorRecorder.h
+ * @brief Provides an observer that records the values of a SensorSubject as a trace.
+ *
+ * The trace can be written to any Print (e.g., a file or the serial port) and replayed later with SensorReplay.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef SENSORRECORDER_H
+    #define SENSORRECORDER_H
+
+    #include <Arduino.h>
+
+    #include "SensorObserver.h"
+    #include "SensorTrace.h"
+
+    /**
+     * @class SensorRecorder
+     * @brief Writes a record for every notification received.
+     */
+    class SensorRecorder : public SensorObserver {
+        public:
+            /**
+             * @brief Constructs a SensorRecorder object.
+             *
+             * @param output The destination of the trace.
+             * @param format The format of the trace, between "SENSOR_TRACE_CSV" and "SENSOR_TRACE_BINARY".
+             */
+            SensorRecorder(Print &output, sensorTraceFormat_t format);
+
+            /**
+             * @brief Writes the header of the trace, if the format needs it.
+             *
+             * This method should be called before adding the recorder to the subject.
+             */
+            void begin();
+
+            /**
+             * @brief Gets the number of records written.
+             *
+             * @return The number of records.
+             */
+            uint32_t getRecords() const;
+
+            /**
+             * @brief Writes a record with the actual time and the values received.
+             *
+             * @param temperature The temperature value (in degrees Celsius).
+             * @param humidity The humidity value (as a percentage).
+             */
+            void update(double temperature, double humidity) override;
+
+        private:
+            Print &output;                      /**< Destination of the trace. */
+            sensorTraceFormat_t format;         /**< Format of the trace. */
+            uint32_t records;                   /**< Number of records written. */
+    };
+
+#endif // SENSORRECORDER_H
@@ -0,0 +1,178 @@
+#include "SensorReplay.h"
+
+SensorReplay::SensorReplay(Stream &input, float speed) : input(input) {
+    this->speed = speed;
+    this->format = SENSOR_TRACE_CSV;
+
+    isRecordPending = false;
+    isEndedInput = false;
+    isEndedTrace = false;
+    isStarted = false;
+    isOverlongLine = false;
+    lengthBuffer = 0;
+
+    records = 0;
+    timestampFirst = 0;
+    timestamp = 0;
+    timeStarted = 0;
+
+    temperature = 0;
+    humidity = 0;
+}
+
+void SensorReplay::begin() {
+    char magic[sizeof(SENSOR_TRACE_MAGIC)];
+
+    /* The binary format starts with its magic, while a CSV line can never start with it. */
+    format = SENSOR_TRACE_CSV;
+    if (input.peek() == SENSOR_TRACE_MAGIC[0]) {
+        if (input.readBytes(magic, sizeof(magic)) == sizeof(magic) && memcmp(magic, SENSOR_TRACE_MAGIC, sizeof(magic)) == 0) {
+            format = SENSOR_TRACE_BINARY;
+        }
+    }
+
+    timeStarted = millis();
+}
+
+void SensorReplay::end() { isEndedInput = true; }
+
+bool SensorReplay::check() {
+    if (isEndedTrace) {
+        return false;
+    }
+
+    if (!isRecordPending) {
+        if (!readRecord()) {
+            /* An empty stream is the end of the trace only when no more data is coming. */
+            if (isEndedInput && input.available() <= 0) {
+                isEndedTrace = true;
+            }
+            return false;
+        }
+
+        isRecordPending = true;
+        if (!isStarted) {
+            isStarted = true;
+            timestampFirst = timestamp;
+        }
+    }
+
+    /* Comparing the elapsed time of the trace with the elapsed time of the replay, scaled by the speed. */
+    if (speed > 0) {
+        const double elapsedReplay = static_cast<double>(millis() - timeStarted) * speed;
+        if (static_cast<double>(timestamp - timestampFirst) > elapsedReplay) {
+            return false;
+        }
+    }
+
+    isRecordPending = false;
+    records++;
+    notify();
+
+    return true;
+}
+
+bool SensorReplay::isEnded() const { return isEndedTrace; }
+
+uint32_t SensorReplay::getRecords() const { return records; }
+
+double SensorReplay::getTemperature() const { return temperature; }
+
+double SensorReplay::getHumidity() const { return humidity; }
+
+void SensorReplay::addObserver(SensorObserver* observer) {
+    if (!observers.add(observer)) {
+        Serial.println("\033[1;91m[SENSOR ERROR: OBSERVER NOT ADDED]\033[0m");
+    }
+}
+
+void SensorReplay::addObserver(SensorObserver* observer, const SensorSubscription &subscription) {
+    if (!observers.add(observer, subscription)) {
+        Serial.println("\033[1;91m[SENSOR ERROR: OBSERVER NOT ADDED]\033[0m");
+    }
+}
+
+void SensorReplay::removeObserver(SensorObserver* observer) { observers.remove(observer); }
+
+void SensorReplay::notify() { observers.notify(temperature, humidity, timestamp); }
+
+bool SensorReplay::readRecord() {
+    while (input.available() > 0) {
+        const int character = input.read();
+        if (character < 0) {
+            break;
+        }
+
+        if (format == SENSOR_TRACE_BINARY) {
+            buffer[lengthBuffer++] = static_cast<char>(character);
+            if (lengthBuffer < SENSOR_TRACE_SIZE_RECORD) {
+                continue;
+            }
+            lengthBuffer = 0;
+
+            const uint8_t *record = reinterpret_cast<const uint8_t *>(buffer);
+            timestamp = static_cast<uint32_t>(record[0]) | (static_cast<uint32_t>(record[1]) << 8) | (static_cast<uint32_t>(record[2]) << 16) | (static_cast<uint32_t>(record[3]) << 24);
+            temperature = static_cast<int16_t>(record[4] | (record[5] << 8)) / 100.0;
+            humidity = static_cast<uint16_t>(record[6] | (record[7] << 8)) / 100.0;
+
+            return true;
+        }
+
+        /* A line longer than the buffer is discarded up to its terminator, not parsed in pieces. */
+        if (character != '\n') {
+            if (lengthBuffer < SENSOR_TRACE_SIZE_LINE - 1) {
+                buffer[lengthBuffer++] = static_cast<char>(character);
+            } else {
+                isOverlongLine = true;
+            }
+            continue;
+        }
+
+        if (parseLine()) {
+            return true;
+        }
+    }
+
+    /* At the end of the input, the last line can be without terminator; a partial binary record is dropped. */
+    if (isEndedInput && format == SENSOR_TRACE_CSV && lengthBuffer > 0) {
+        return parseLine();
+    }
+
+    return false;
+}
+
+bool SensorReplay::parseLine() {
+    buffer[lengthBuffer] = '\0';
+    lengthBuffer = 0;
+
+    if (isOverlongLine) {
+        isOverlongLine = false;
+        return false;
+    }
+
+    /* Looking for the first number followed by a comma, skipping headers, logs and the time of the monitor. */
+    char *end = buffer;
+    const char *field = buffer;
+    while (*field != '\0') {
+        if (isDigit(*field)) {
+            timestamp = strtoul(field, &end, 10);
+            if (*end == ',') {
+                break;
+            }
+            field = end;
+        } else {
+            field++;
+        }
+    }
+    if (*field == '\0') {
+        return false;
+    }
+
+    temperature = strtod(end + 1, &end);
+    if (*end != ',') {
+        return false;
+    }
+    humidity = strtod(end + 1, &end);
+
+    return true;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file SensorReplay.h
+ * @brief Provides a SensorSubject that replays a recorded trace of temperature and humidity.
+ *
+ * The replay drives the observers (e.g., Screen and ApiManagement) without any sensor hardware, at real speed or
+ * accelerated. Subscriptions are evaluated on the time of the trace, so filters behave as they would on the device
+ * even when days of data are replayed in a few seconds.
+ *
+ * A stream cannot tell a momentary lack of data from its end (e.g., the serial port between two lines), so the input
+ * is read without blocking, a partial line or record is kept until the rest arrives, and the trace ends only after
+ * `end()` has been called and every record of the input has been delivered.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.1.0
+ * @date 18th October 2026
+ */
+
+#ifndef SENSORREPLAY_H
+    #define SENSORREPLAY_H
+
+    #include <Arduino.h>
+
+    #include "SensorSubject.h"
+    #include "SensorObserverRegistry.h"
+    #include "SensorTrace.h"
+    #include "SensorConsts.h"
+
+    /**
+     * @class SensorReplay
+     * @brief Reads the records of a trace and notifies the observers when their time is reached.
+     */
+    class SensorReplay : public SensorSubject {
+        public:
+            /**
+             * @brief Constructs a SensorReplay object.
+             *
+             * @param input The source of the trace, in CSV or binary format.
+             * @param speed Factor applied to the time of the trace (e.g., 3600 replays an hour per second);
+             *  0 replays a record at every `check()`, as fast as possible.
+             */
+            explicit SensorReplay(Stream &input, float speed = 1);
+
+            /**
+             * @brief Detects the format of the trace and starts the clock of the replay.
+             */
+            void begin();
+
+            /**
+             * @brief Marks the end of the input: the records still in the stream are delivered, then the trace is ended.
+             *
+             * To call once the source has no more data, e.g., right after `begin()` for a file or a string.
+             */
+            void end();
+
+            /**
+             * @brief Delivers the next record if it has been received and its time is reached.
+             *
+             * @return True if a record has been delivered, false otherwise.
+             */
+            bool check();
+
+            /**
+             * @brief Checks if the whole trace has been replayed.
+             *
+             * @return True if the input has been ended and every record delivered, false otherwise.
+             */
+            bool isEnded() const;
+
+            /**
+             * @brief Gets the number of records delivered.
+             *
+             * @return The number of records.
+             */
+            uint32_t getRecords() const;
+
+            /**
+             * @brief Retrieves the last replayed temperature value.
+             *
+             * @return The most recent temperature.
+             */
+            double getTemperature() const;
+
+            /**
+             * @brief Retrieves the last replayed humidity value.
+             *
+             * @return The most recent humidity.
+             */
+            double getHumidity() const;
+
+            void addObserver(SensorObserver* observer) override;
+            void addObserver(SensorObserver* observer, const SensorSubscription &subscription) override;
+
+            /**
+             * @brief Adds an observer of a known type, bound at compile time.
+             *
+             * @tparam T The concrete type of the observer (e.g., Screen, ApiManagement).
+             * @param observer Pointer to the observer object to be added.
+             * @param subscription Minimum interval, resolution and channels that wake the observer.
+             */
+            template <typename T>
+            void addObserver(T* observer, const SensorSubscription &subscription = SENSOR_SUBSCRIPTION_DEFAULT) {
+                if (!observers.add(observer, subscription)) {
+                    Serial.println("\033[1;91m[SENSOR ERROR: OBSERVER NOT ADDED]\033[0m");
+                }
+            }
+
+            void removeObserver(SensorObserver* observer) override;
+
+        private:
+            SensorObserverRegistry<SENSOR_MAX_OBSERVERS> observers;     /**< Observer objects that get notified on data changes. */
+            Stream &input;                                              /**< Source of the trace. */
+            float speed;                                                /**< Factor applied to the time of the trace. */
+            sensorTraceFormat_t format;                                 /**< Format of the trace. */
+            bool isRecordPending;                                       /**< Flag to indicate if a record has been read but not delivered yet. */
+            bool isEndedInput;                                          /**< Flag to indicate if the input has no more data. */
+            bool isEndedTrace;                                          /**< Flag to indicate if the trace is ended. */
+            bool isOverlongLine;                                        /**< Flag to indicate if the line being received is discarded. */
+            char buffer[SENSOR_TRACE_SIZE_LINE];                        /**< Part of the line or of the record received so far. */
+            uint8_t lengthBuffer;                                       /**< Number of characters in the buffer. */
+            bool isStarted;                                             /**< Flag to indicate if the first record has been read. */
+            uint32_t records;                                           /**< Number of records delivered. */
+            uint32_t timestampFirst;                                    /**< Time of the first record of the trace. */
+            uint32_t timestamp;                                         /**< Time of the pending record. */
+            unsigned long timeStarted;                                  /**< Time in milliseconds when the replay started. */
+            double temperature;                                         /**< Temperature of the pending record, or the last delivered. */
+            double humidity;                                            /**< Humidity of the pending record, or the last delivered. */
+
+            /**
+             * @brief Reads the next record from the characters available, without waiting for the others.
+             *
+             * @return True if a record has been read, false if no whole record has been received yet.
+             */
+            bool readRecord();
+
+            /**
+             * @brief Parses the line in the buffer, looking for the first number followed by a comma.
+             *
+             * @return True if the line holds a record, false otherwise.
+             */
+            bool parseLine();
+
+            /** @brief Notifies the observers of the pending record. */
+            void notify() override;
+    };
+
+#endif // SENSORREPLAY_H
@@ -4,10 +4,12 @@
     #include <Arduino.h>
 
     #include "SensorObserver.h"
+    #include "SensorSubscription.h"
 
     class SensorSubject {
         public:
             virtual void addObserver(SensorObserver* observer) = 0;
+            virtual void addObserver(SensorObserver* observer, const SensorSubscription &subscription) = 0;
             virtual void removeObserver(SensorObserver* observer) = 0;
             virtual void notify()  = 0;
             virtual ~SensorSubject() = default;
@@ -0,0 +1,27 @@
+#ifndef SENSORSUBSCRIPTION_H
+    #define SENSORSUBSCRIPTION_H
+
+    #include <Arduino.h>
+
+    constexpr uint8_t SENSOR_CHANNEL_TEMPERATURE =  0x01;
+    constexpr uint8_t SENSOR_CHANNEL_HUMIDITY =     0x02;
+    constexpr uint8_t SENSOR_CHANNEL_CO2 =          0x04;
+    constexpr uint8_t SENSOR_CHANNEL_PRESSURE =     0x08;
+    constexpr uint8_t SENSOR_CHANNEL_ALL =          SENSOR_CHANNEL_TEMPERATURE | SENSOR_CHANNEL_HUMIDITY | SENSOR_CHANNEL_CO2 | SENSOR_CHANNEL_PRESSURE;
+    constexpr uint8_t SENSOR_CHANNEL_DEVICES =      0x80;       // Also receives the reading of every single device, through "updateReading()".
+
+    /**
+     * @brief Describes when an observer wants to be woken by the subject.
+     *
+     * The observer is notified only if at least one of its channels has changed by a full resolution step
+     * since the last delivered value, and at least `minInterval` milliseconds have elapsed since the last delivery.
+     */
+    struct SensorSubscription {
+        uint32_t minInterval;                   /**< Minimum time in milliseconds between two notifications; 0 for none. */
+        uint8_t channels;                       /**< Bitmask of the channels of interest (e.g., "SENSOR_CHANNEL_TEMPERATURE"). */
+        double temperatureResolution;           /**< Smallest temperature step of interest; 0 for every change. */
+        double humidityResolution;              /**< Smallest humidity step of interest; 0 for every change. */
+    };
+
+    constexpr SensorSubscription SENSOR_SUBSCRIPTION_DEFAULT = {0, SENSOR_CHANNEL_ALL, 0, 0};
+#endif
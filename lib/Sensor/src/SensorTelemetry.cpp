@@ -0,0 +1,94 @@
+#include "SensorTelemetry.h"
+
+SensorTelemetry::SensorTelemetry() {
+    latencyLast = 0;
+    latencyMin = 0;
+    latencyMax = 0;
+
+    for (uint32_t &bucket : histogram) {
+        bucket = 0;
+    }
+
+    samples = 0;
+    failures = 0;
+    rejections = 0;
+    unchangedSamples = 0;
+
+    samplesPerMinute = 0;
+    samplesActualMinute = 0;
+    endTimeoutMinute = 0;
+}
+
+void SensorTelemetry::recordRead(uint32_t latency, bool isChanged, unsigned long now) {
+    latencyLast = latency;
+    if (samples == 0 || latency < latencyMin) {
+        latencyMin = latency;
+    }
+    if (latency > latencyMax) {
+        latencyMax = latency;
+    }
+
+    /* Finding the bucket by doubling the upper limit, at most "SENSOR_TELEMETRY_HISTOGRAM_BUCKETS" steps. */
+    uint8_t bucket = 0;
+    uint32_t limit = SENSOR_TELEMETRY_HISTOGRAM_FIRST;
+    while (latency >= limit && bucket < SENSOR_TELEMETRY_HISTOGRAM_BUCKETS - 1) {
+        limit <<= 1;
+        bucket++;
+    }
+    histogram[bucket]++;
+
+    samples++;
+
+    if (isChanged) {
+        unchangedSamples = 0;
+    } else if (unchangedSamples < UINT16_MAX) {
+        unchangedSamples++;
+    }
+
+    rollMinute(now);
+    samplesActualMinute++;
+}
+
+void SensorTelemetry::recordFailure(unsigned long now) {
+    failures++;
+
+    rollMinute(now);
+}
+
+void SensorTelemetry::recordRejection() { rejections++; }
+
+uint32_t SensorTelemetry::getLatencyLast() const { return latencyLast; }
+
+uint32_t SensorTelemetry::getLatencyMin() const { return latencyMin; }
+
+uint32_t SensorTelemetry::getLatencyMax() const { return latencyMax; }
+
+uint32_t SensorTelemetry::getHistogram(uint8_t bucket) const { return bucket < SENSOR_TELEMETRY_HISTOGRAM_BUCKETS ? histogram[bucket] : 0; }
+
+uint32_t SensorTelemetry::getSamples() const { return samples; }
+
+uint32_t SensorTelemetry::getFailures() const { return failures; }
+
+uint32_t SensorTelemetry::getRejections() const { return rejections; }
+
+uint16_t SensorTelemetry::getSamplesPerMinute(unsigned long now) const {
+    /* The actual minute is over but not closed yet: it is the last complete one, unless a whole minute followed it. */
+    if (endTimeoutMinute != 0 && static_cast<long>(endTimeoutMinute - now) <= 0) {
+        return (now - endTimeoutMinute < 60000) ? samplesActualMinute : 0;
+    }
+
+    return samplesPerMinute;
+}
+
+bool SensorTelemetry::isStuck() const { return unchangedSamples >= SENSOR_TELEMETRY_STUCK_SAMPLES; }
+
+void SensorTelemetry::rollMinute(unsigned long now) {
+    /* Closing the actual minute, if elapsed. The first record only opens it. */
+    if (endTimeoutMinute == 0) {
+        endTimeoutMinute = now + 60000;
+    } else if (static_cast<long>(endTimeoutMinute - now) <= 0) {
+        samplesPerMinute = getSamplesPerMinute(now);
+        samplesActualMinute = 0;
+        endTimeoutMinute = now + 60000;
+    }
+}
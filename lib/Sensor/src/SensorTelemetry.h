@@ -0,0 +1,141 @@
+/**
+ * @file SensorTelemetry.h
+ * @brief Provides health and timing counters of a single device of the Sensor registry.
+ *
+ * The counters are updated once per conversion cycle with a handful of integer operations, so they can stay
+ * enabled in production and be used to find degrading sensors and slow buses before they turn into data gaps.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.1.0
+ * @date 18th October 2026
+ */
+
+#ifndef SENSORTELEMETRY_H
+    #define SENSORTELEMETRY_H
+
+    #include <Arduino.h>
+
+    #include "SensorConsts.h"
+
+    /**
+     * @class SensorTelemetry
+     * @brief Tracks read latency, failures, rejections, stuck values and rate of samples of a device.
+     */
+    class SensorTelemetry {
+        public:
+            SensorTelemetry();
+
+            /**
+             * @brief Records a successful read.
+             *
+             * @param latency Duration of the read, in microseconds.
+             * @param isChanged True if at least one value differs from the previous read.
+             * @param now The actual time in milliseconds.
+             */
+            void recordRead(uint32_t latency, bool isChanged, unsigned long now);
+
+            /**
+             * @brief Records a failed trigger or read (e.g., NACK on the I2C bus).
+             *
+             * @param now The actual time in milliseconds.
+             */
+            void recordFailure(unsigned long now);
+
+            /** @brief Records a value rejected because out of range. */
+            void recordRejection();
+
+            /**
+             * @brief Gets the duration of the last read.
+             *
+             * @return The latency in microseconds.
+             */
+            uint32_t getLatencyLast() const;
+
+            /**
+             * @brief Gets the shortest read since boot.
+             *
+             * @return The latency in microseconds, or 0 if there was no read.
+             */
+            uint32_t getLatencyMin() const;
+
+            /**
+             * @brief Gets the longest read since boot.
+             *
+             * @return The latency in microseconds.
+             */
+            uint32_t getLatencyMax() const;
+
+            /**
+             * @brief Gets the number of reads falling in a bucket of the latency histogram.
+             *
+             * Bucket 0 holds reads shorter than `SENSOR_TELEMETRY_HISTOGRAM_FIRST` microseconds; every next bucket
+             *  doubles the upper limit and the last one holds all longer reads.
+             *
+             * @param bucket The index of the bucket.
+             * @return The number of reads.
+             */
+            uint32_t getHistogram(uint8_t bucket) const;
+
+            /**
+             * @brief Gets the number of successful reads since boot.
+             *
+             * @return The number of reads.
+             */
+            uint32_t getSamples() const;
+
+            /**
+             * @brief Gets the number of failed triggers and reads since boot.
+             *
+             * @return The number of failures.
+             */
+            uint32_t getFailures() const;
+
+            /**
+             * @brief Gets the number of values rejected because out of range, since boot.
+             *
+             * @return The number of rejections.
+             */
+            uint32_t getRejections() const;
+
+            /**
+             * @brief Gets the number of successful reads in the last complete minute.
+             *
+             * @param now The actual time in milliseconds, so a device that stopped reading is not reported by its last minute.
+             * @return The number of reads, 0 if there was none.
+             */
+            uint16_t getSamplesPerMinute(unsigned long now) const;
+
+            /**
+             * @brief Checks if the device keeps returning the same values.
+             *
+             * @return True if the last `SENSOR_TELEMETRY_STUCK_SAMPLES` reads did not change, false otherwise.
+             */
+            bool isStuck() const;
+
+        private:
+            uint32_t latencyLast;                                       /**< Duration of the last read. */
+            uint32_t latencyMin;                                        /**< Shortest read. */
+            uint32_t latencyMax;                                        /**< Longest read. */
+            uint32_t histogram[SENSOR_TELEMETRY_HISTOGRAM_BUCKETS];     /**< Histogram of the latency. */
+            uint32_t samples;                                           /**< Successful reads. */
+            uint32_t failures;                                          /**< Failed triggers and reads. */
+            uint32_t rejections;                                        /**< Values out of range. */
+            uint16_t unchangedSamples;                                  /**< Consecutive reads without changes. */
+            uint16_t samplesPerMinute;                                  /**< Reads in the last complete minute. */
+            uint16_t samplesActualMinute;                               /**< Reads in the actual minute. */
+            unsigned long endTimeoutMinute;                             /**< Timeout marker for the end of the actual minute. */
+
+            /**
+             * @brief Closes the actual minute if elapsed, on every read and failure.
+             *
+             * @param now The actual time in milliseconds.
+             */
+            void rollMinute(unsigned long now);
+    };
+
+#endif // SENSORTELEMETRY_H
@@ -0,0 +1,20 @@
+#ifndef SENSORTRACE_H
+    #define SENSORTRACE_H
+
+    #include <Arduino.h>
+
+    /*
+     * Formats of a trace of temperature and humidity:
+     *  - CSV, one "timestamp,temperature,humidity" line per record, with the timestamp in milliseconds;
+     *    a record starts at the first number followed by a comma, so a log of the serial monitor can be replayed as it
+     *    is, also with the "HH:MM:SS.mmm > " of its "time" filter; lines without records and lines longer than
+     *    "SENSOR_TRACE_SIZE_LINE" are skipped.
+     *  - Binary, the magic "AAT1" followed by records of 8 bytes, little endian: timestamp in milliseconds (uint32_t),
+     *    temperature in hundredths of °C (int16_t) and humidity in hundredths of % (uint16_t).
+     */
+    typedef enum sensorTraceFormat : uint8_t {SENSOR_TRACE_CSV, SENSOR_TRACE_BINARY} sensorTraceFormat_t;
+
+    constexpr char SENSOR_TRACE_MAGIC[4] =                      {'A', 'A', 'T', '1'};
+    constexpr uint8_t SENSOR_TRACE_SIZE_RECORD =                8;
+    constexpr uint8_t SENSOR_TRACE_SIZE_LINE =                  48;
+#endif // SENSORTRACE_H
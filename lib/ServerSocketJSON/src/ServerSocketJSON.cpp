@@ -2,17 +2,18 @@
 
 ServerSocketJSON::ServerSocketJSON() {
     this->server = nullptr;
+    this->isLinkUp = false;
 }
 
 bool ServerSocketJSON::begin(uint16_t port) {
-    if (!isConnected()) {
+    if (server == nullptr) {
         server = new WiFiServer(port);
-        server->begin();
-
-        return true;
+    } else if (server->status() == LISTEN) {
+        return false;
     }
 
-    return false;
+    server->begin();
+    return true;
 }
 
 void ServerSocketJSON::end() {
@@ -20,7 +21,9 @@ void ServerSocketJSON::end() {
         client.stop();
     }
 
-    server->stop();
+    if (server != nullptr) {
+        server->stop();
+    }
 }
 
 bool ServerSocketJSON::attachClient() {
@@ -52,7 +55,7 @@ bool ServerSocketJSON::detachClient() {
 }
 
 bool ServerSocketJSON::isConnected() {
-    if (WiFi.status() == WL_CONNECTED && server != nullptr && server->status() == LISTEN) {
+    if (isLinkUp && server != nullptr && server->status() == LISTEN) {
         return true;
     }
 
@@ -79,7 +82,7 @@ uint8_t ServerSocketJSON::listen() {
 
                 client.flush();
 
-                return jsonDocumentRequest[SERVER_SOCKET_FIELD_REQUEST_CODE];
+                return jsonDocumentRequest[FPSTR(SERVER_SOCKET_FIELD_REQUEST_CODE)];
             }
         }
     }
@@ -99,4 +102,14 @@ bool ServerSocketJSON::speak(const String &message) {
 
 String ServerSocketJSON::getJsonRequestSerialized() {
     return this->jsonRequestSerialized;
-}
\ No newline at end of file
+}
+
+void ServerSocketJSON::updateLink(bool isConnected) {
+    isLinkUp = isConnected;
+
+    if (!isLinkUp) {
+        detachClient();
+    } else if (server != nullptr && server->status() != LISTEN) {
+        server->begin();
+    }
+}
@@ -14,8 +14,8 @@
  * @author Davide Palladino
  * @contact davidepalladino@hotmail.com
  * @website https://davidepalladino.github.io/
- * @version 3.0.0
- * @date 28th January 2025
+ * @version 3.1.0
+ * @date 18th October 2026
  *
  * @include ArduinoJson v6.18.2.
  */
@@ -25,6 +25,7 @@
 
     #include <Arduino.h>
     #include <ESP8266WiFi.h>
+    #include <WiFiConnectionObserver.h>
 
     #include "ServerSocketJSONConsts.h"
 
@@ -39,7 +40,7 @@
      * This class enables the device to act as a server, receiving and sending JSON messages via Wi-Fi.
      * It provides methods for managing clients, checking server/client status, and sending/receiving JSON messages.
      */
-    class ServerSocketJSON {
+    class ServerSocketJSON : public WiFiConnectionObserver {
         public:
             /**
              * @brief Constructor to initialize the server socket.
@@ -49,10 +50,11 @@
             /**
              * @brief Initializes the server socket and begins listening for clients.
              *
-             * This method starts the server socket on the specified port and ensures Wi-Fi is connected.
+             * This method starts the server socket on the specified port; it can be called before the link is up, and the
+             *  server is reused if already created.
              *
-             * @param port The port to listen for incoming connections.
-             * @return True if the server was successfully started, false if Wi-Fi is not connected.
+             * @param port The port to listen for incoming connections, used only by the first call.
+             * @return True if the server was successfully started, false if it was already listening.
              */
             bool begin(uint16_t port);
 
@@ -82,7 +84,7 @@
             /**
              * @brief Checks if the server is actively running.
              *
-             * Determines whether the server is active and ready to accept client connections.
+             * Determines whether the link is up and the server is active and ready to accept client connections.
              *
              * @return True if the server is running, false otherwise.
              */
@@ -123,10 +125,19 @@
              */
             String getJsonRequestSerialized();
 
+            /**
+             * @brief Updates the state of the link: the client is dropped when it goes down, and the server listens
+             *  again when it comes back.
+             *
+             * @param isConnected True if the link is up, false otherwise.
+             */
+            void updateLink(bool isConnected) override;
+
         private:
             WiFiServer *server;                 ///< Pointer to the WiFiServer instance for handling client connections.
             WiFiClient client;                  ///< WiFiClient instance to interact with the connected client.
             String jsonRequestSerialized;       ///< Holds the last received serialized JSON request.
+            bool isLinkUp;                      ///< Indicates whether the link notified by WiFiConnection is up.
     };
 
 #endif
@@ -2,8 +2,8 @@
     #define SERVERSOCKETJSONCONSTS_H
     constexpr uint8_t SERVER_SOCKET_SIZE_USERNAME =         20;
     constexpr uint8_t SERVER_SOCKET_SIZE_PASSWORD =         64;
-    const String SERVER_SOCKET_FIELD_REQUEST_CODE =         "request_code";
-    const String SERVER_SOCKET_FIELD_MESSAGE =              "message";
-    const String SERVER_SOCKET_FIELD_MESSAGE_USERNAME =     "username";
-    const String SERVER_SOCKET_FIELD_MESSAGE_PASSWORD =     "password";
+    inline const char SERVER_SOCKET_FIELD_REQUEST_CODE[] PROGMEM =      "request_code";
+    inline const char SERVER_SOCKET_FIELD_MESSAGE[] PROGMEM =           "message";
+    inline const char SERVER_SOCKET_FIELD_MESSAGE_USERNAME[] PROGMEM =  "username";
+    inline const char SERVER_SOCKET_FIELD_MESSAGE_PASSWORD[] PROGMEM =  "password";
 #endif // SERVERSOCKETJSONCONSTS_H
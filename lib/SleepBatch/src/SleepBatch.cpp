@@ -0,0 +1,78 @@
+#include "SleepBatch.h"
+
+SleepBatch::SleepBatch(uint8_t wakesPerUpload) : memory(), wakesPerUpload(wakesPerUpload > 0 ? wakesPerUpload : 1) {}
+
+bool SleepBatch::begin() {
+    const bool isRead = ESP.rtcUserMemoryRead(SLEEP_BATCH_RTC_OFFSET, reinterpret_cast<uint32_t*>(&memory), sizeof(memory));
+    const bool isValid = isRead && memory.magic == SLEEP_BATCH_MAGIC && memory.crc == calculateCRC() && memory.count <= SLEEP_BATCH_MAX_SAMPLES && memory.first < SLEEP_BATCH_MAX_SAMPLES;
+
+    if (!isValid) {
+        memory = Memory();
+        memory.magic = SLEEP_BATCH_MAGIC;
+    }
+    memory.wakes++;
+
+    return isValid;
+}
+
+void SleepBatch::add(uint32_t epoch, double temperature, double humidity) {
+    if (memory.count == SLEEP_BATCH_MAX_SAMPLES) {
+        remove(1);
+    }
+
+    SleepBatchSample &sample = memory.samples[(memory.first + memory.count) % SLEEP_BATCH_MAX_SAMPLES];
+    sample.epoch = epoch;
+    sample.temperature = static_cast<int16_t>(lround(temperature * 10));
+    sample.humidity = static_cast<uint16_t>(lround(constrain(humidity, 0.0, 100.0) * 10));
+    memory.count++;
+}
+
+SleepBatchSample SleepBatch::get(uint8_t index) const { return memory.samples[(memory.first + index) % SLEEP_BATCH_MAX_SAMPLES]; }
+
+void SleepBatch::remove(uint8_t total) {
+    total = min(total, memory.count);
+    memory.first = (memory.first + total) % SLEEP_BATCH_MAX_SAMPLES;
+    memory.count -= total;
+
+    /* Once uploaded everything, the counting of the wakes starts again. */
+    if (memory.count == 0) {
+        memory.wakes = 1;
+    }
+}
+
+uint8_t SleepBatch::size() const { return memory.count; }
+
+uint16_t SleepBatch::getWakes() const { return memory.wakes; }
+
+bool SleepBatch::isUploadDue() const { return (memory.wakes % wakesPerUpload) == 0 || memory.count == SLEEP_BATCH_MAX_SAMPLES; }
+
+uint32_t SleepBatch::getTimeBootLast() const { return memory.timeBootLast; }
+
+uint8_t SleepBatch::getWiFiDirected() const { return memory.wifiDirected; }
+
+void SleepBatch::setWiFiDirected(uint8_t directed) { memory.wifiDirected = directed; }
+
+void SleepBatch::sleep(uint32_t time) {
+    const bool isNextUpload = ((memory.wakes + 1) % wakesPerUpload) == 0 || (memory.count + 1) >= SLEEP_BATCH_MAX_SAMPLES;
+
+    memory.timeBootLast = micros();
+    memory.crc = calculateCRC();
+    ESP.rtcUserMemoryWrite(SLEEP_BATCH_RTC_OFFSET, reinterpret_cast<uint32_t*>(&memory), sizeof(memory));
+
+    ESP.deepSleep(static_cast<uint64_t>(time) * 1000, isNextUpload ? WAKE_RF_DEFAULT : WAKE_RF_DISABLED);
+}
+
+uint32_t SleepBatch::calculateCRC() const {
+    const uint8_t *data = reinterpret_cast<const uint8_t*>(&memory) + offsetof(Memory, wakes);
+    size_t length = sizeof(memory) - offsetof(Memory, wakes);
+    uint32_t crc = 0xFFFFFFFF;
+
+    while (length--) {
+        crc ^= *data++;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+
+    return ~crc;
+}
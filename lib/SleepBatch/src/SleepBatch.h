@@ -0,0 +1,163 @@
+/**
+ * @file SleepBatch.h
+ * @brief Provides a buffer of samples kept in the RTC user memory across the deep sleeps of ESP8266.
+ *
+ * In deep sleep only the RTC domain stays powered, so the device can wake up, take a sample, append it to this
+ * buffer and sleep again without ever turning on the radio; the Wi-Fi is brought up only every few wakes, to upload
+ * the whole batch at once. The buffer is checked with a CRC, so after a power loss, or a reset not caused by the
+ * deep sleep, it starts empty instead of uploading garbage.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.1.0
+ * @date 18th October 2026
+ */
+
+#ifndef SLEEPBATCH_H
+    #define SLEEPBATCH_H
+
+    #include <Arduino.h>
+
+    #include "SleepBatchConsts.h"
+
+    /**
+     * @brief A sample, in the compact form stored into the RTC user memory.
+     */
+    struct SleepBatchSample {
+        uint32_t epoch;                                             /**< Datetime of the sample, as Unix time. */
+        int16_t temperature;                                        /**< Temperature, in tenths of degree. */
+        uint16_t humidity;                                          /**< Humidity, in tenths of percentage. */
+    };
+
+    /**
+     * @class SleepBatch
+     * @brief Stores up to `SLEEP_BATCH_MAX_SAMPLES` samples, dropping the oldest when full.
+     */
+    class SleepBatch {
+        public:
+            /**
+             * @brief Constructs a SleepBatch object.
+             *
+             * @param wakesPerUpload The number of wakes between two uploads.
+             */
+            explicit SleepBatch(uint8_t wakesPerUpload);
+
+            /**
+             * @brief Loads the buffer from the RTC user memory and counts this wake.
+             *
+             * @return True if the buffer was valid, false if it has been cleared.
+             */
+            bool begin();
+
+            /**
+             * @brief Appends a sample, dropping the oldest one if the buffer is full.
+             *
+             * @param epoch The datetime of the sample, as Unix time.
+             * @param temperature The temperature, in degrees.
+             * @param humidity The humidity, in percentage.
+             */
+            void add(uint32_t epoch, double temperature, double humidity);
+
+            /**
+             * @brief Gets a stored sample.
+             *
+             * @param index The index of the sample, where 0 is the oldest.
+             * @return The sample.
+             * @warning The index must be lower than `size()`.
+             */
+            SleepBatchSample get(uint8_t index) const;
+
+            /**
+             * @brief Removes the oldest samples, once uploaded.
+             *
+             * @param total The number of samples to remove.
+             */
+            void remove(uint8_t total);
+
+            /**
+             * @brief Gets the number of stored samples.
+             *
+             * @return The number of stored samples.
+             */
+            uint8_t size() const;
+
+            /**
+             * @brief Gets the number of wakes since the buffer has been cleared, this one included.
+             *
+             * @return The number of wakes.
+             */
+            uint16_t getWakes() const;
+
+            /**
+             * @brief Checks if this wake has to upload the batch.
+             *
+             * @return True if the wakes per upload are elapsed or the buffer is full, false otherwise.
+             */
+            bool isUploadDue() const;
+
+            /**
+             * @brief Gets the time from boot to sleep of the previous wake.
+             *
+             * @return The time in microseconds, 0 if unknown.
+             */
+            uint32_t getTimeBootLast() const;
+
+            /**
+             * @brief Gets the associations of the Wi-Fi that used the cached lease, kept across the deep sleep.
+             *
+             * @return The number of associations, 0 if the buffer has been cleared.
+             */
+            uint8_t getWiFiDirected() const;
+
+            /**
+             * @brief Sets the associations of the Wi-Fi that used the cached lease, saved with the buffer.
+             *
+             * @param directed The number of associations, as given by the WiFiConnection.
+             */
+            void setWiFiDirected(uint8_t directed);
+
+            /**
+             * @brief Saves the buffer into the RTC user memory and puts the chip in deep sleep.
+             *
+             * The radio is calibrated at the next boot only if that wake will upload, the others boot with it off.
+             *
+             * @param time The time to sleep in milliseconds.
+             * @warning The chip wakes up only if GPIO16 is wired to RST; this method never returns.
+             */
+            void sleep(uint32_t time);
+
+        private:
+            /**
+             * @brief Image of the RTC user memory, with the samples as ring buffer.
+             */
+            struct Memory {
+                uint32_t magic;
+                uint32_t crc;
+                uint16_t wakes;
+                uint8_t count;
+                uint8_t first;
+                uint32_t timeBootLast;
+                uint8_t wifiDirected;
+                uint8_t reserved[3];
+                SleepBatchSample samples[SLEEP_BATCH_MAX_SAMPLES];
+            } memory;
+
+            uint8_t wakesPerUpload;
+
+            /**
+             * @brief Calculates the CRC-32 of the buffer, excluding the magic and the CRC itself.
+             *
+             * @return The CRC-32.
+             */
+            uint32_t calculateCRC() const;
+
+            static_assert(sizeof(SleepBatchSample) == SLEEP_BATCH_SAMPLE_SIZE, "The size of a sample must match its constant.");
+            static_assert(offsetof(Memory, samples) == SLEEP_BATCH_HEADER_SIZE, "The size of the header must match its constant.");
+            static_assert(sizeof(Memory) <= SLEEP_BATCH_RTC_SIZE, "The buffer must fit into the RTC user memory.");
+    };
+
+#endif // SLEEPBATCH_H
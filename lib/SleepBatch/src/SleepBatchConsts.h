@@ -0,0 +1,9 @@
+#ifndef SLEEPBATCHCONSTS_H
+    #define SLEEPBATCHCONSTS_H
+    constexpr uint32_t SLEEP_BATCH_MAGIC = 0x41414232;              // "AAB2", marks a buffer written by this firmware.
+    constexpr uint8_t SLEEP_BATCH_RTC_OFFSET = 32;                  // Blocks of 4 bytes; the first 128 bytes of the RTC user memory are used by the OTA update.
+    constexpr uint16_t SLEEP_BATCH_RTC_SIZE = 384;                  // Bytes of the RTC user memory left after the offset.
+    constexpr uint8_t SLEEP_BATCH_HEADER_SIZE = 20;
+    constexpr uint8_t SLEEP_BATCH_SAMPLE_SIZE = 8;
+    constexpr uint8_t SLEEP_BATCH_MAX_SAMPLES = (SLEEP_BATCH_RTC_SIZE - SLEEP_BATCH_HEADER_SIZE) / SLEEP_BATCH_SAMPLE_SIZE;
+#endif // SLEEPBATCHCONSTS_H
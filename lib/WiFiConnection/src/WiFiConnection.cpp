@@ -0,0 +1,263 @@
+#include "WiFiConnection.h"
+
+WiFiConnection *WiFiConnection::instanceWPS = nullptr;
+
+WiFiConnection::WiFiConnection() : cache(), isCached(false), isDirected(false), isStaticIP(false), directed(0), state(WIFI_CONNECTION_IDLE), timeStartedState(0), timeBackoff(WIFI_CONNECTION_BACKOFF_FIRST), timeAssociation(0), isPendingGotIP(false), isPendingDisconnected(false), isLastDisconnected(false), statusWPS(-1), observers(), observersCount(0) {}
+
+void WiFiConnection::begin(const String &ssid, const String &password, const String &hostname, const WiFiConnectionCache *cache, uint8_t directed) {
+    this->ssid = ssid;
+    this->password = password;
+    this->directed = directed;
+
+    isCached = cache != nullptr && isValid(*cache);
+    if (isCached) {
+        this->cache = *cache;
+    }
+
+    registerEvents();
+
+    /* The reconnections are driven here, with the backoff, instead of the SDK. */
+    WiFi.persistent(false);
+    WiFi.setAutoReconnect(false);
+    WiFi.mode(WIFI_STA);
+    WiFi.hostname(hostname);
+
+    connect();
+}
+
+bool WiFiConnection::beginWPS() {
+    if (state == WIFI_CONNECTION_WPS) {
+        return false;
+    }
+
+    registerEvents();
+
+    const bool wasConnected = isConnected();
+    WiFi.mode(WIFI_STA);
+    WiFi.disconnect();
+    WiFi.config(IPAddress(static_cast<uint32_t>(0)), IPAddress(static_cast<uint32_t>(0)), IPAddress(static_cast<uint32_t>(0)));
+
+    statusWPS = -1;
+    instanceWPS = this;
+    wifi_wps_disable();
+    if (!wifi_wps_enable(WPS_TYPE_PBC) || !wifi_set_wps_cb(handleWPS) || !wifi_wps_start()) {
+        Serial.println(F("\033[1;91m[WIFI ERROR: WPS NOT STARTED]\033[0m"));
+        wifi_wps_disable();
+        connect();
+
+        return false;
+    }
+
+    state = WIFI_CONNECTION_WPS;
+    timeStartedState = millis();
+    if (wasConnected) {
+        notifyLink(false);
+    }
+
+    return true;
+}
+
+wifiConnectionEvent_t WiFiConnection::check() {
+    /* The events of the SDK only set the flags, the work is done here, outside of their context. */
+    const bool isGotIP = isPendingGotIP;
+    const bool isDisconnected = isPendingDisconnected;
+    const bool isDisconnectedLast = isLastDisconnected;
+    isPendingGotIP = false;
+    isPendingDisconnected = false;
+
+    switch (state) {
+        case WIFI_CONNECTION_CONNECTING:
+            /* Both events since the previous call: the link is up only if the IP came after the disconnection. */
+            if (isGotIP && isDisconnected && isDisconnectedLast) {
+                Serial.println(F("\033[1;91m[WIFI ERROR: LINK LOST WHILE ASSOCIATING, RETRYING]\033[0m"));
+                connect();
+                break;
+            }
+
+            if (isGotIP) {
+                state = WIFI_CONNECTION_CONNECTED;
+                timeAssociation = millis() - timeStartedState;
+                timeBackoff = WIFI_CONNECTION_BACKOFF_FIRST;
+                Serial.println("\033[1;92m[WIFI ASSOCIATED IN " + String(timeAssociation) + " ms" + (isStaticIP ? ", DIRECTED]" : (isDirected ? ", DIRECTED WITH DHCP]" : ", SCAN]")) + "\033[0m");
+
+                /* The actual connection directs the next association, after a drop or a reboot; a lease from DHCP starts its count again. */
+                directed = isStaticIP ? directed + 1 : 0;
+                memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+                cache.channel = static_cast<uint8_t>(WiFi.channel());
+                cache.ip = WiFi.localIP();
+                cache.gateway = WiFi.gatewayIP();
+                cache.subnet = WiFi.subnetMask();
+                cache.dns = WiFi.dnsIP();
+                cache.checksum = calculateChecksum(cache);
+                isCached = isValid(cache);
+
+                notifyLink(true);
+                return WIFI_CONNECTION_EVENT_LINK_UP;
+            }
+
+            if (isDirected && (millis() - timeStartedState) >= WIFI_CONNECTION_TIMEOUT_DIRECTED) {
+                /* The access point, the channel or the lease may have changed: starting again from scratch, with DHCP. */
+                Serial.println(F("\033[1;91m[WIFI ERROR: DIRECTED ASSOCIATION FAILED, SCANNING]\033[0m"));
+                isCached = false;
+                connect();
+            } else if (!isDirected && (millis() - timeStartedState) >= WIFI_CONNECTION_TIMEOUT_SCAN) {
+                Serial.println("\033[1;91m[WIFI ERROR: ASSOCIATION FAILED, RETRY IN " + String(timeBackoff) + " ms]\033[0m");
+                WiFi.disconnect();
+                state = WIFI_CONNECTION_BACKOFF;
+                timeStartedState = millis();
+            }
+            break;
+
+        case WIFI_CONNECTION_CONNECTED:
+            if (isDisconnected) {
+                /* The lease may be the cause, for example taken by another host, so the next one comes from DHCP. */
+                if (isStaticIP) {
+                    directed = WIFI_CONNECTION_CACHE_MAX_DIRECTED;
+                }
+
+                notifyLink(false);
+                connect();
+
+                return WIFI_CONNECTION_EVENT_LINK_DOWN;
+            }
+            break;
+
+        case WIFI_CONNECTION_BACKOFF:
+            if ((millis() - timeStartedState) >= timeBackoff) {
+                timeBackoff = min(timeBackoff * 2, WIFI_CONNECTION_BACKOFF_MAXIMUM);
+                connect();
+            }
+            break;
+
+        case WIFI_CONNECTION_WPS:
+            if (statusWPS >= 0) {
+                return endWPS(statusWPS == WPS_CB_ST_SUCCESS);
+            }
+
+            if ((millis() - timeStartedState) >= WIFI_CONNECTION_TIMEOUT_WPS) {
+                return endWPS(false);
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return WIFI_CONNECTION_EVENT_NONE;
+}
+
+wifiConnectionState_t WiFiConnection::getState() const { return state; }
+
+bool WiFiConnection::isConnected() const { return state == WIFI_CONNECTION_CONNECTED; }
+
+const String& WiFiConnection::getSSID() const { return ssid; }
+
+const String& WiFiConnection::getPassword() const { return password; }
+
+uint32_t WiFiConnection::getTimeAssociation() const { return timeAssociation; }
+
+bool WiFiConnection::getCache(WiFiConnectionCache &cache) const {
+    cache = this->cache;
+
+    return isCached;
+}
+
+uint8_t WiFiConnection::getDirected() const { return directed; }
+
+bool WiFiConnection::isValid(const WiFiConnectionCache &cache) {
+    return cache.checksum == calculateChecksum(cache) && cache.channel >= 1 && cache.channel <= 14;
+}
+
+bool WiFiConnection::addObserver(WiFiConnectionObserver *observer) {
+    if (observer == nullptr || observersCount == WIFI_CONNECTION_MAX_OBSERVERS) {
+        return false;
+    }
+
+    observers[observersCount++] = observer;
+    if (isConnected()) {
+        observer->updateLink(true);
+    }
+
+    return true;
+}
+
+void WiFiConnection::registerEvents() {
+    if (!handlerGotIP) {
+        handlerGotIP = WiFi.onStationModeGotIP([this](const WiFiEventStationModeGotIP &event) { isPendingGotIP = true; isLastDisconnected = false; });
+        handlerDisconnected = WiFi.onStationModeDisconnected([this](const WiFiEventStationModeDisconnected &event) { isPendingDisconnected = true; isLastDisconnected = true; });
+    }
+}
+
+void WiFiConnection::connect() {
+    if (ssid.isEmpty()) {
+        state = WIFI_CONNECTION_IDLE;
+        return;
+    }
+
+    isDirected = isCached;
+    isStaticIP = isCached && directed < WIFI_CONNECTION_CACHE_MAX_DIRECTED;
+    if (isStaticIP) {
+        WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.subnet), IPAddress(cache.dns));
+        WiFi.begin(ssid, password, cache.channel, cache.bssid);
+    } else if (isDirected) {
+        /* The lease has been used long enough: renewing it, still on the cached access point. */
+        WiFi.config(IPAddress(static_cast<uint32_t>(0)), IPAddress(static_cast<uint32_t>(0)), IPAddress(static_cast<uint32_t>(0)));
+        WiFi.begin(ssid, password, cache.channel, cache.bssid);
+    } else {
+        WiFi.config(IPAddress(static_cast<uint32_t>(0)), IPAddress(static_cast<uint32_t>(0)), IPAddress(static_cast<uint32_t>(0)));
+        WiFi.begin(ssid, password);
+    }
+
+    state = WIFI_CONNECTION_CONNECTING;
+    timeStartedState = millis();
+}
+
+wifiConnectionEvent_t WiFiConnection::endWPS(bool isSuccessful) {
+    wifi_wps_disable();
+    instanceWPS = nullptr;
+
+    /* The SDK already stored the received credentials into the configuration of the station. */
+    if (isSuccessful && WiFi.SSID().length() > 0) {
+        ssid = WiFi.SSID();
+        password = WiFi.psk();
+        isCached = false;
+    } else {
+        isSuccessful = false;
+        Serial.println(F("\033[1;91m[WIFI ERROR: WPS FAILED]\033[0m"));
+    }
+
+    connect();
+    notifyWPS(isSuccessful);
+
+    return isSuccessful ? WIFI_CONNECTION_EVENT_WPS_SUCCESS : WIFI_CONNECTION_EVENT_WPS_FAILURE;
+}
+
+void WiFiConnection::notifyLink(bool isConnected) {
+    for (uint8_t i = 0; i < observersCount; i++) {
+        observers[i]->updateLink(isConnected);
+    }
+}
+
+void WiFiConnection::notifyWPS(bool isSuccessful) {
+    for (uint8_t i = 0; i < observersCount; i++) {
+        observers[i]->updateWPS(isSuccessful);
+    }
+}
+
+void WiFiConnection::handleWPS(int status) {
+    if (instanceWPS != nullptr) {
+        instanceWPS->statusWPS = static_cast<int8_t>(status);
+    }
+}
+
+uint8_t WiFiConnection::calculateChecksum(const WiFiConnectionCache &cache) {
+    const uint8_t *data = reinterpret_cast<const uint8_t*>(&cache);
+    uint8_t checksum = WIFI_CONNECTION_CACHE_SEED;
+    for (uint8_t i = 0; i < sizeof(WiFiConnectionCache); i++) {
+        if (i != offsetof(WiFiConnectionCache, checksum)) {
+            checksum = (checksum << 1 | checksum >> 7) ^ data[i];
+        }
+    }
+
+    return checksum;
+}
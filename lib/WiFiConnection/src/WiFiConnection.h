@@ -0,0 +1,199 @@
+/**
+ * @file WiFiConnection.h
+ * @brief Provides a non-blocking manager of the Wi-Fi connection of the station, WPS included.
+ *
+ * The connection is a state machine driven by the events of ESP8266 (got IP, disconnected) and by timeouts, checked
+ * once per loop: an association is first directed to the cached access point, with its lease as static IP, then
+ * falls back to a full scan with DHCP, and after a failure waits with an exponential backoff before trying again.
+ * The lease is applied without the DHCP server knowing it, so once expired its address can be given to another host,
+ * and both would answer to it: the lease is therefore used for `WIFI_CONNECTION_CACHE_MAX_DIRECTED` associations
+ * only, then renewed with DHCP on the cached access point, and it is never used again after its link drops.
+ * The count is kept out of the cache, so the cache stored by the caller changes only with the access point or the
+ * lease, and its storage is not written at every association.
+ * The WPS runs in background too, through the callback of the SDK. The subsystems subscribe to the link going up and
+ * down, instead of polling the status of the Wi-Fi.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.2.1
+ * @date 18th October 2026
+ */
+
+#ifndef WIFICONNECTION_H
+    #define WIFICONNECTION_H
+
+    #include <Arduino.h>
+    #include <ESP8266WiFi.h>
+
+    #include "WiFiConnectionConsts.h"
+    #include "WiFiConnectionObserver.h"
+
+    typedef enum wifiConnectionState : uint8_t {WIFI_CONNECTION_IDLE, WIFI_CONNECTION_CONNECTING, WIFI_CONNECTION_CONNECTED, WIFI_CONNECTION_BACKOFF, WIFI_CONNECTION_WPS} wifiConnectionState_t;
+    typedef enum wifiConnectionEvent : uint8_t {WIFI_CONNECTION_EVENT_NONE, WIFI_CONNECTION_EVENT_LINK_UP, WIFI_CONNECTION_EVENT_LINK_DOWN, WIFI_CONNECTION_EVENT_WPS_SUCCESS, WIFI_CONNECTION_EVENT_WPS_FAILURE} wifiConnectionEvent_t;
+
+    /**
+     * @brief Access point and DHCP lease of a connection that worked, to direct the next association.
+     */
+    struct WiFiConnectionCache {
+        uint8_t bssid[6];                                           /**< MAC address of the access point. */
+        uint8_t channel;                                            /**< Channel of the access point. */
+        uint8_t checksum;                                           /**< Checksum of the other fields, with `WIFI_CONNECTION_CACHE_SEED`. */
+        uint32_t ip;                                                /**< Local IP address of the lease. */
+        uint32_t gateway;                                           /**< Gateway of the lease. */
+        uint32_t subnet;                                            /**< Subnet mask of the lease. */
+        uint32_t dns;                                               /**< DNS server of the lease. */
+    };
+
+    /**
+     * @class WiFiConnection
+     * @brief Keeps the station connected, notifying the observers when the link goes up or down.
+     */
+    class WiFiConnection {
+        public:
+            WiFiConnection();
+
+            /**
+             * @brief Starts the connection, without waiting for it.
+             *
+             * @param ssid The SSID (name) of the Wi-Fi network.
+             * @param password The password required to join the Wi-Fi network.
+             * @param hostname The hostname of the device.
+             * @param cache The cache of the last connection, to direct the first association; nullptr for a full scan.
+             * @param directed The associations that already used the lease of the cache, for example before a deep sleep.
+             */
+            void begin(const String &ssid, const String &password, const String &hostname, const WiFiConnectionCache *cache = nullptr, uint8_t directed = 0);
+
+            /**
+             * @brief Starts the WPS (push button), without waiting for it; the result is given by `check()`.
+             *
+             * @return True if started, false if already running or refused by the SDK.
+             */
+            bool beginWPS();
+
+            /**
+             * @brief Advances the state machine, to call once per loop.
+             *
+             * @return The event happened since the previous call, if any.
+             */
+            wifiConnectionEvent_t check();
+
+            /**
+             * @brief Gets the actual state.
+             *
+             * @return The state.
+             */
+            wifiConnectionState_t getState() const;
+
+            /**
+             * @brief Checks if the link is up.
+             *
+             * @return True if connected with an IP address, false otherwise.
+             */
+            bool isConnected() const;
+
+            /**
+             * @brief Gets the SSID, updated by a successful WPS.
+             *
+             * @return The SSID.
+             */
+            const String& getSSID() const;
+
+            /**
+             * @brief Gets the password, updated by a successful WPS.
+             *
+             * @return The password.
+             */
+            const String& getPassword() const;
+
+            /**
+             * @brief Gets the time of the last association.
+             *
+             * @return The time in milliseconds, from the start of the association to the IP address.
+             */
+            uint32_t getTimeAssociation() const;
+
+            /**
+             * @brief Gets the cache of the actual connection, to store for the next boot.
+             *
+             * @return True if the cache is valid, false if never connected.
+             */
+            bool getCache(WiFiConnectionCache &cache) const;
+
+            /**
+             * @brief Gets the associations that used the lease of the cache as static IP since DHCP gave it.
+             *
+             * @return The number of associations, to give to the next `begin()` if the RAM is lost meanwhile.
+             */
+            uint8_t getDirected() const;
+
+            /**
+             * @brief Checks if a cache, for example read from a storage, is valid.
+             *
+             * @param cache The cache to check.
+             * @return True if valid, false otherwise.
+             */
+            static bool isValid(const WiFiConnectionCache &cache);
+
+            /**
+             * @brief Adds an observer of the link, notified immediately if the link is already up.
+             *
+             * @param observer The observer to add.
+             * @return True if added, false if the capacity is full.
+             */
+            bool addObserver(WiFiConnectionObserver *observer);
+
+        private:
+            String ssid;
+            String password;
+            WiFiConnectionCache cache;                              /**< Cache of the last connection, valid if `isCached`. */
+            bool isCached;
+            bool isDirected;                                        /**< Flag to indicate if the actual association uses the cache. */
+            bool isStaticIP;                                        /**< Flag to indicate if the actual association uses the cached lease. */
+            uint8_t directed;                                       /**< Associations that used the cached lease since DHCP gave it. */
+            wifiConnectionState_t state;
+            unsigned long timeStartedState;
+            uint32_t timeBackoff;
+            uint32_t timeAssociation;
+
+            volatile bool isPendingGotIP;                           /**< Set by the event of the SDK, consumed by `check()`. */
+            volatile bool isPendingDisconnected;                    /**< Set by the event of the SDK, consumed by `check()`. */
+            volatile bool isLastDisconnected;                       /**< Flag to indicate if the last event of the SDK is the disconnection, to order both. */
+            volatile int8_t statusWPS;                              /**< Result of the WPS set by the callback of the SDK, -1 if none. */
+            WiFiEventHandler handlerGotIP;
+            WiFiEventHandler handlerDisconnected;
+
+            WiFiConnectionObserver *observers[WIFI_CONNECTION_MAX_OBSERVERS];
+            uint8_t observersCount;
+
+            static WiFiConnection *instanceWPS;                     /**< The callback of the WPS of the SDK has no argument. */
+
+            /**
+             * @brief Registers the handlers of the events, once.
+             */
+            void registerEvents();
+
+            /**
+             * @brief Starts an association, directed if the cache is valid, with its lease until it has to be renewed.
+             */
+            void connect();
+
+            /**
+             * @brief Handles the end of the WPS.
+             *
+             * @param isSuccessful True if the credentials have been received.
+             * @return The event of the result.
+             */
+            wifiConnectionEvent_t endWPS(bool isSuccessful);
+
+            void notifyLink(bool isConnected);
+            void notifyWPS(bool isSuccessful);
+
+            static void handleWPS(int status);
+            static uint8_t calculateChecksum(const WiFiConnectionCache &cache);
+    };
+
+#endif // WIFICONNECTION_H
@@ -0,0 +1,11 @@
+#ifndef WIFICONNECTIONCONSTS_H
+    #define WIFICONNECTIONCONSTS_H
+    constexpr uint8_t WIFI_CONNECTION_MAX_OBSERVERS = 4;            // Capacity of the observers, allocated inline.
+    constexpr uint16_t WIFI_CONNECTION_TIMEOUT_DIRECTED = 3000;     // Longest association with the cached access point, before a full scan.
+    constexpr uint16_t WIFI_CONNECTION_TIMEOUT_SCAN = 20000;        // Longest association with a full scan, before the backoff.
+    constexpr uint32_t WIFI_CONNECTION_TIMEOUT_WPS = 130000;        // Guard over the 2 minutes of the WPS of the SDK.
+    constexpr uint16_t WIFI_CONNECTION_BACKOFF_FIRST = 1000;        // First wait after a failed association; every next one doubles.
+    constexpr uint32_t WIFI_CONNECTION_BACKOFF_MAXIMUM = 60000;
+    constexpr uint8_t WIFI_CONNECTION_CACHE_SEED = 0xA5;            // Seed of the checksum of the cache, so an erased one is never valid.
+    constexpr uint8_t WIFI_CONNECTION_CACHE_MAX_DIRECTED = 6;       // Associations with the cached lease before renewing it with DHCP; an hour in batch mode.
+#endif // WIFICONNECTIONCONSTS_H
@@ -0,0 +1,12 @@
+#ifndef WIFICONNECTIONOBSERVER_H
+    #define WIFICONNECTIONOBSERVER_H
+
+    #include <Arduino.h>
+
+    class WiFiConnectionObserver {
+        public:
+            virtual void updateLink(bool isConnected) = 0;
+            virtual void updateWPS(bool isSuccessful) { }
+            virtual ~WiFiConnectionObserver() = default;
+    };
+#endif
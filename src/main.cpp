@@ -14,6 +14,11 @@
 
 #include <Configuration.h>
 #include <SensorObserver.h>
+#include <SensorRecorder.h>
+#include <Scheduler.h>
+#include <SchedulerIdle.h>
+#include <Profiler.h>
+#include <WiFiConnection.h>
 
 #include "utils.h"
 #include "settings.h"
@@ -21,50 +26,122 @@
 FirmwareUpdateOTA firmwareUpdate;
 ServerSocketJSON serverSocket;
 Button button(BUTTON_PIN, B_PULLUP, BUTTON_TIME_LONG_PRESS);
+ButtonGesture buttonGesture(button, BUTTON_TIME_MULTI_CLICK, BUTTON_TIME_REPEAT);
 Sensor sensor(SENSOR_ADDRESS, SENSOR_HUMIDITY_RESOLUTION, SENSOR_TEMPERATURE_RESOLUTION);
 Screen screen(SCREEN_PIN_SCL, SCREEN_PIN_SDA);
+SensorRecorder sensorRecorder(Serial, SENSOR_TRACE_CSV);
 
 NTPClient ntpClient(*new WiFiUDP(), (long) 0);
-ApiManagement apiManagement(*(new DatetimeInterval(ntpClient)));
+DatetimeInterval datetimeInterval(ntpClient);
+ApiManagement apiManagement(datetimeInterval);
+SleepBatch sleepBatch(BATCH_WAKES_PER_UPLOAD);
 
-String wifiSSID;
-String wifiPassword;
-uint8_t requestCodeSocket = 0;
-int8_t resultButton = 0;
-unsigned long timeoutSaveEEPROM = 0;
-unsigned long timeoutTurnOffScreen = 0;
-unsigned long timeoutTurnOnScreen = 0;
-bool errorSavingDatabase = false;
+WiFiConnection wifiConnection;
+bool isNetworkLoaded = false;
 
-constexpr uint16_t TIME_TURN_OFF = 3000;  // Don't change this value.
-constexpr uint16_t TIME_TURN_ON = 100;    // Don't change this value.
+uint8_t requestCodeSocket = 0;
+gesture_t resultGesture = G_NONE;
+wifiConnectionEvent_t resultConnection = WIFI_CONNECTION_EVENT_NONE;
+
+Scheduler scheduler;
+SchedulerIdle schedulerIdle(scheduler);
+int8_t idTaskSensor = -1;
+int8_t idTaskScreen = -1;
+int8_t idTaskStatus = -1;
+int8_t idTaskSaveRoom = -1;
+int8_t idTaskUpdateRoom = -1;
+int8_t idTaskProfilerReport = -1;
+int8_t idTaskNetwork = -1;
+int8_t idTaskMainPage = -1;
+int8_t idTaskUpload = -1;
+uint32_t timeRetryUpdateRoom = TIME_RETRY_FIRST;
+uint32_t timeRetryUpload = TIME_RETRY_FIRST;
+
+Profiler profiler;
+int8_t idStageWiFi = -1;
+int8_t idStageSocket = -1;
+int8_t idStageButton = -1;
+int8_t idStageSensor = -1;
+int8_t idStageScreen = -1;
+int8_t idStageStatus = -1;
+int8_t idStageEEPROM = -1;
+int8_t idStageUpdateRoom = -1;
+int8_t idStageUpload = -1;
+int8_t idStageNetwork = -1;
+
+void taskSensor();
+void taskScreen();
+void taskStatus();
+void taskSaveRoom();
+void taskUpdateRoom();
+void taskProfilerReport();
+void taskNetwork();
+void taskMainPage();
+void taskUpload();
+uint32_t backoff(uint32_t &timeRetry);
 
 void setup() {
     Serial.begin(BAUDRATE);
-    screen.begin();
+
+    /* Nothing has been allocated by the setup yet: this is the heap left by the globals and their static init. */
+    Serial.print(F("\nFree heap after static init: "));
+    Serial.print(ESP.getFreeHeap());
+    Serial.println(F(" bytes"));
+
     EEPROM.begin(SIZE_EEPROM);
 
     uint8_t actualVersionEEPROM = 0;
+    EEPROM.get(ADDRESS_VERSION_EEPROM, actualVersionEEPROM);
+
+    /* In batch mode, a configured device only samples and sleeps; the installation still needs the normal boot. */
+    if (BATCH_MODE && actualVersionEEPROM == VERSION_EEPROM) {
+        configurationBatch(sleepBatch, sensor, datetimeInterval, apiManagement, wifiConnection);
+    }
+
+    button.begin();
+    screen.begin();
+
+    /* Adding observers to WiFiConnection, so nothing polls the status of the Wi-Fi. */
+    wifiConnection.addObserver(&screen);
+    wifiConnection.addObserver(&serverSocket);
+    wifiConnection.addObserver(&apiManagement);
+    wifiConnection.addObserver(&datetimeInterval);
 
-    /* Adding observers to Sensor. */
-    sensor.addObserver(&apiManagement);
-    sensor.addObserver(&screen);
+    /*
+     * Adding observers to Sensor, each one woken only when it has work to do.
+     * The apiManagement is added even without network, since it queues the measures with the datetime of the RTC.
+     */
+    sensor.addObserver(&apiManagement, SENSOR_SUBSCRIPTION_API_MANAGEMENT);
+    sensor.addObserver(&screen, SENSOR_SUBSCRIPTION_SCREEN);
+    apiManagement.setSensor(&sensor);
+    if (SENSOR_RECORD_TRACE) {
+        sensorRecorder.begin();
+        sensor.addObserver(&sensorRecorder);
+    }
 
-    /* Showing brand, with version, and checking if is requested of reset. */
-    showBrand(button, screen, const_cast<String&>(VERSION_FIRMWARE), ADDRESS_VERSION_EEPROM, TIME_LOGO, TIME_MESSAGE);
-    Serial.println("\nVersion firmware: " + VERSION_FIRMWARE);
+    /*
+     * Showing brand, with version, and checking if is requested of reset.
+     * With the fast boot, the brand waits for the reset only if the button is held since the power on.
+     */
+    if (!FAST_BOOT || button.isPressed()) {
+        showBrand(buttonGesture, screen, VERSION_FIRMWARE, ADDRESS_VERSION_EEPROM, TIME_LOGO, TIME_MESSAGE);
+    } else {
+        screen.showBrand(VERSION_FIRMWARE);
+    }
+    Serial.print(F("\nVersion firmware: "));
+    Serial.println(FPSTR(VERSION_FIRMWARE));
 
     /* Checking the version of data on EEPROM, to execute the right update of EEPROM and/or system. */
     EEPROM.get(ADDRESS_VERSION_EEPROM, actualVersionEEPROM);
     switch (actualVersionEEPROM) {
         /* If this is a first utilization about the system, will be launched the installation. */
         case 0:
-            configurationVersion1(button, screen);
+            configurationVersion1(buttonGesture, screen, wifiConnection);
 
         /* Else if is a first or the second version, will be launched the upgrade to version 3. */
         case 1:
         case 2:
-            configurationVersion3(serverSocket, screen, apiManagement);
+            configurationVersion3(serverSocket, screen, apiManagement, wifiConnection);
 
             /*
              * Showing a message of complete.
@@ -74,16 +151,90 @@ void setup() {
             delay(TIME_MESSAGE);
 
         default:
-            configurationLoad(firmwareUpdate, serverSocket, sensor, screen, apiManagement, wifiSSID, wifiPassword);
+            if (FAST_BOOT) {
+                configurationLoadFast(serverSocket, sensor, screen, apiManagement, wifiConnection);
+            } else {
+                isNetworkLoaded = configurationLoad(firmwareUpdate, serverSocket, sensor, screen, apiManagement, wifiConnection);
+            }
     }
     EEPROM.end();
 
-    screen.showMainPage();
+    screen.requestMainPage();
+    screen.wake();
+
+    /* Registering the work of the loop, so each part runs only when it is due. */
+    idTaskSensor = scheduler.add(taskSensor);
+    idTaskScreen = scheduler.add(taskScreen, timeFrameInterval);
+    idTaskStatus = scheduler.add(taskStatus, TIME_CHECK_STATUS);
+    idTaskSaveRoom = scheduler.add(taskSaveRoom);
+    idTaskUpdateRoom = scheduler.add(taskUpdateRoom);
+    idTaskProfilerReport = scheduler.add(taskProfilerReport, TIME_PROFILER_REPORT);
+    idTaskNetwork = scheduler.add(taskNetwork);
+    idTaskMainPage = scheduler.add(taskMainPage);
+    idTaskUpload = scheduler.add(taskUpload);
+    scheduler.schedule(idTaskSensor, 0);
+    scheduler.schedule(idTaskScreen, 0);
+    scheduler.schedule(idTaskStatus, 0);
+    scheduler.schedule(idTaskProfilerReport, TIME_PROFILER_REPORT);
+
+    /* The boot never waits for the backend, so the room is updated later if it has not been now. */
+    if (!apiManagement.isUpdated()) {
+        scheduler.schedule(idTaskUpdateRoom, backoff(timeRetryUpdateRoom));
+    }
 
-    timeoutTurnOffScreen = millis() + TIME_TURN_OFF;
+    /* Timing every stage of the loop, to find the one that causes jitter and freezes. */
+    idStageWiFi = profiler.addStage(PROFILER_STAGE_WIFI);
+    idStageSocket = profiler.addStage(PROFILER_STAGE_SOCKET);
+    idStageButton = profiler.addStage(PROFILER_STAGE_BUTTON);
+    idStageSensor = profiler.addStage(PROFILER_STAGE_SENSOR);
+    idStageScreen = profiler.addStage(PROFILER_STAGE_SCREEN);
+    idStageStatus = profiler.addStage(PROFILER_STAGE_STATUS);
+    idStageEEPROM = profiler.addStage(PROFILER_STAGE_EEPROM);
+    idStageUpdateRoom = profiler.addStage(PROFILER_STAGE_UPDATE_ROOM);
+    idStageUpload = profiler.addStage(PROFILER_STAGE_UPLOAD);
+    idStageNetwork = profiler.addStage(PROFILER_STAGE_NETWORK);
+
+    /* The Wi-Fi is configured, so the chip can sleep between the deadlines. */
+    schedulerIdle.begin(LOOP_SLEEP);
+
+    Serial.println("Setup completed in " + String(millis()) + " ms, free heap " + String(ESP.getFreeHeap()) + " bytes");
 }
 
 void loop() {
+    uint32_t cyclesStage = Profiler::start();
+
+    /*
+     * Advancing the connection and reacting to its events:
+     *  - link up to run the work that needs the network;
+     *  - end of the WPS to store the new credentials and show the result, without blocking meanwhile.
+     */
+    resultConnection = wifiConnection.check();
+    if (resultConnection == WIFI_CONNECTION_EVENT_LINK_UP) {
+        scheduler.schedule(idTaskNetwork, 0);
+    } else if (resultConnection == WIFI_CONNECTION_EVENT_WPS_SUCCESS) {
+        char c_wifiSSID[SIZE_WIFI_SSID];
+        char c_wifiPassword[SIZE_WIFI_PASSWORD];
+        wifiConnection.getSSID().toCharArray(c_wifiSSID, SIZE_WIFI_SSID);
+        wifiConnection.getPassword().toCharArray(c_wifiPassword, SIZE_WIFI_PASSWORD);
+
+        EEPROM.begin(SIZE_EEPROM);
+        EEPROM.put(ADDRESS_WIFI_SSID, c_wifiSSID);
+        EEPROM.put(ADDRESS_WIFI_PASSWORD, c_wifiPassword);
+        EEPROM.commit();
+        EEPROM.end();
+
+        screen.wake();
+        screen.showMessagePage(messagePageSuccessfulMessage);
+        scheduler.schedule(idTaskMainPage, TIME_MESSAGE);
+    } else if (resultConnection == WIFI_CONNECTION_EVENT_WPS_FAILURE) {
+        screen.wake();
+        screen.showMessagePage(messagePageErrorMessages);
+        scheduler.schedule(idTaskMainPage, TIME_MESSAGE);
+    }
+
+    profiler.record(idStageWiFi, cyclesStage);
+    cyclesStage = Profiler::start();
+
     /* Checking if the device is connected like server. */
     if (serverSocket.isConnected()) {
         serverSocket.attachClient();
@@ -92,6 +243,8 @@ void loop() {
         if (requestCodeSocket > 0) {
             unsigned long timeStartedMessage;
 
+            screen.wake();
+
             switch (requestCodeSocket) {
                 case 1:
                     timeStartedMessage = millis();
@@ -104,101 +257,184 @@ void loop() {
                     delay(calculateDelay(static_cast<long>(timeStartedMessage), TIME_MESSAGE));
                     break;
 
+                case 2:
+                    socketSendSensorTelemetry(serverSocket, sensor, schedulerIdle);
+                    break;
+
+                case 3:
+                    socketSendLoopProfile(serverSocket, profiler);
+                    profiler.print(Serial);
+                    break;
+
                 default:
                     break;
             }
         }
-    } else {
-        serverSocket.end();
+    } else if (wifiConnection.isConnected()) {
         serverSocket.begin(SERVER_SOCKET_PORT);
     }
 
+    profiler.record(idStageSocket, cyclesStage);
+    cyclesStage = Profiler::start();
+
     /* 
-     * Checking the status of button and execution the right action:
-     *  - "-1" to execute WPS connection;
-     *  - "1" to show the screen or change the room number, if the screen is already turned on.
+     * Checking the gesture on the button and execution the right action:
+     *  - long press to execute WPS connection;
+     *  - click to toggle between the history page and the main page;
+     *  - double click to change the room number and go back to the main page.
      */
-    resultButton = button.checkPress();
-    if (resultButton == -1) {
-        screen.showMessagePage(messagePageSearchingMessage);
-
-        if (WiFi.beginWPSConfig()) {
-            if (WiFi.SSID().length() > 0) {
-                char c_wifiPassword[SIZE_WIFI_PASSWORD];
-                char c_wifiSSID[SIZE_WIFI_SSID];
-
-                wifiSSID = WiFi.SSID();
-                wifiSSID.toCharArray(c_wifiSSID, SIZE_WIFI_SSID);
-                wifiPassword = WiFi.psk();
-                wifiPassword.toCharArray(c_wifiPassword, SIZE_WIFI_PASSWORD);
-
-                EEPROM.begin(SIZE_EEPROM);
-                EEPROM.put(ADDRESS_WIFI_SSID, c_wifiSSID);
-                EEPROM.put(ADDRESS_WIFI_PASSWORD, c_wifiPassword);
-                EEPROM.commit();
-                EEPROM.end();
-
-                screen.showMessagePage(messagePageSuccessfulMessage);
-                delay(TIME_MESSAGE);
-            } else {
-                WiFi.begin(wifiSSID, wifiPassword);
+    resultGesture = buttonGesture.check();
+    if (resultGesture != G_NONE || button.isPressed()) {
+        screen.wake();
+    }
 
-                screen.showMessagePage(messagePageErrorMessages);
-                delay(TIME_MESSAGE);
-            }
+    if (resultGesture == G_LONG_PRESS) {
+        /* The message is kept until the result of the WPS, which comes from the connection. */
+        if (wifiConnection.beginWPS()) {
+            scheduler.cancel(idTaskMainPage);
+            screen.showMessagePage(messagePageSearchingMessage);
+            screen.requestOtherPage();
         }
-    } else if (resultButton == 1) {
+    } else if (resultGesture == G_CLICK) {
+        if (screen.getRequestedPage() != SCREEN_PAGE_HISTORY) {
+            screen.requestHistoryPage();
+        } else {
+            screen.requestMainPage();
+        }
+    } else if (resultGesture == G_DOUBLE_CLICK) {
         if (apiManagement.getRoomNumber() == MAX_ROOM_NUMBER) {
             apiManagement.setRoomNumber(MIN_ROOM_NUMBER);
         } else {
             apiManagement.setRoomNumber(apiManagement.getRoomNumber() + 1);
         }
         screen.setRoomNumber(apiManagement.getRoomNumber());
-        screen.showMainPage();
+        screen.requestMainPage();
+
+        /* Every change moves the saving forward, so a sequence of changes is saved once. */
+        scheduler.cancel(idTaskUpdateRoom);
+        scheduler.schedule(idTaskSaveRoom, TIME_SAVE_EEPROM);
     }
 
-    /* Saving on EEPROM and updating the apiManagement only if the time is elapsed. */
-    if ((timeoutSaveEEPROM < millis()) && (timeoutSaveEEPROM != 0)) {
-        timeoutSaveEEPROM = 0;
+    profiler.record(idStageButton, cyclesStage);
+
+    /* Running only the tasks whose deadline is elapsed, then sleeping until the next one. */
+    scheduler.run();
+    schedulerIdle.idle(TIME_IDLE_MAXIMUM);
+}
 
-        errorSavingDatabase = !apiManagement.updateRoom();
+void taskSensor() {
+    ProfilerScope scope(profiler, idStageSensor);
+
+    sensor.check();
+
+    /*
+     * The observers only queue the measures, so the requests of the upload are timed in their own stage.
+     * While the upload is backing off, its retry already scheduled sends the new measures too.
+     */
+    if (apiManagement.isUploadDue() && timeRetryUpload == TIME_RETRY_FIRST) {
+        scheduler.schedule(idTaskUpload, 0);
+    }
+
+    /* The sensor knows when the next conversion has to start or to be collected. */
+    scheduler.schedule(idTaskSensor, sensor.getTimeToNextCheck());
+}
+
+void taskScreen() {
+    ProfilerScope scope(profiler, idStageScreen);
+
+    /*
+     * Composing, at most once per frame, all the changes of the screen collected since the previous frame.
+     * The screen is protected from burn-in by moving the layout and lowering the contrast, without clearing it.
+     */
+    screen.render();
+}
+
+void taskStatus() {
+    ProfilerScope scope(profiler, idStageStatus);
+
+    /* Updating the status icon of the updates on the screen if there is a change; the one of the link is notified. */
+    if (screen.isUpdated() != apiManagement.isUpdated()) {
+        screen.isUpdated(apiManagement.isUpdated());
+    }
+}
+
+void taskSaveRoom() {
+    {
+        ProfilerScope scope(profiler, idStageEEPROM);
 
         EEPROM.begin(SIZE_EEPROM);
-            if (EEPROM.read(ADDRESS_ROOM_ID) != apiManagement.getRoomNumber()) {
+        if (EEPROM.read(ADDRESS_ROOM_ID) != apiManagement.getRoomNumber()) {
             EEPROM.write(ADDRESS_ROOM_ID, apiManagement.getRoomNumber());
             EEPROM.commit();
         }
         EEPROM.end();
     }
 
-    /* Updating the status icons on the screen if there is a change. */
-    if (screen.isUpdated() != apiManagement.isUpdated()) {
-        screen.isUpdated(apiManagement.isUpdated());
-        screen.showMainPage();
-    }  
+    taskUpdateRoom();
+}
 
-    if (screen.isConnected() != WiFi.isConnected()) {
-        screen.isConnected(WiFi.isConnected());
-        screen.showMainPage();
-    } 
+void taskUpdateRoom() {
+    ProfilerScope scope(profiler, idStageUpdateRoom);
 
-    /* If there was an error on previous saving of the new room ID into apiManagement, there will be a new attempt. */
-    if (errorSavingDatabase) {
-        errorSavingDatabase = !apiManagement.updateRoom();
+    /* If there is an error on saving of the new room ID into apiManagement, there will be a new attempt later, each one further. */
+    if (apiManagement.updateRoom()) {
+        timeRetryUpdateRoom = TIME_RETRY_FIRST;
+    } else {
+        scheduler.schedule(idTaskUpdateRoom, backoff(timeRetryUpdateRoom));
     }
+}
+
+void taskProfilerReport() {
+    profiler.print(Serial);
+}
 
-    /* Protecting the screen by applying standby and recovering after certain time. */
-    if ((timeoutTurnOffScreen < millis()) && (timeoutTurnOffScreen != 0)) {
-        screen.clear();
+void taskNetwork() {
+    ProfilerScope scope(profiler, idStageNetwork);
 
-        timeoutTurnOffScreen = 0;
-        timeoutTurnOnScreen = millis() + TIME_TURN_ON;
-    } else if ((timeoutTurnOnScreen < millis()) && (timeoutTurnOnScreen != 0)) {
-        screen.showMainPage();
+    /* Every time the link comes up, its access point and lease direct the next association. */
+    EEPROM.begin(SIZE_EEPROM);
+    saveWiFiCache(wifiConnection);
+    EEPROM.end();
 
-        timeoutTurnOffScreen = millis() + TIME_TURN_OFF;
-        timeoutTurnOnScreen = 0;
+    /* The work that needs the network waits for the first link up, while the device already works offline. */
+    if (!isNetworkLoaded) {
+        if (!configurationLoadNetwork(firmwareUpdate, screen, wifiConnection)) {
+            return;
+        }
+        isNetworkLoaded = true;
+
+        Serial.println("Network ready in " + String(millis()) + " ms");
     }
 
-    sensor.check();
-}
\ No newline at end of file
+    /* Registering the room and sending the measures queued while offline, without waiting for the next ones. */
+    timeRetryUpdateRoom = TIME_RETRY_FIRST;
+    timeRetryUpload = TIME_RETRY_FIRST;
+    if (!apiManagement.isUpdated()) {
+        scheduler.schedule(idTaskUpdateRoom, 0);
+    }
+    if (apiManagement.getMeasuresQueued() > 0) {
+        scheduler.schedule(idTaskUpload, 0);
+    }
+}
+
+void taskMainPage() {
+    screen.requestMainPage();
+}
+
+void taskUpload() {
+    ProfilerScope scope(profiler, idStageUpload);
+
+    /* If the upload fails, the measures stay queued and are sent with a new attempt, each one further; without link, at its return. */
+    if (apiManagement.upload()) {
+        timeRetryUpload = TIME_RETRY_FIRST;
+    } else if (wifiConnection.isConnected() && apiManagement.getMeasuresQueued() > 0) {
+        scheduler.schedule(idTaskUpload, backoff(timeRetryUpload));
+    }
+}
+
+uint32_t backoff(uint32_t &timeRetry) {
+    const uint32_t time = timeRetry;
+    timeRetry = min(timeRetry * 2, TIME_RETRY_MAXIMUM);
+
+    return time;
+}
@@ -1,10 +1,38 @@
 #ifndef SETTINGS_H
     #define SETTINGS_H
     #include <ClosedCube_HDC1080.h>
+    #include <SensorSubscription.h>
+    #include <SchedulerIdle.h>
 
     // EEPROM
     constexpr uint16_t TIME_SAVE_EEPROM =                                       5000;
 
+    // Loop
+    constexpr uint16_t TIME_CHECK_STATUS =                                      1000;       // Status icons of the screen.
+    constexpr uint32_t TIME_RETRY_FIRST =                                       30000;      // First new attempt of a request to apiManagement that failed; every next one doubles.
+    constexpr uint32_t TIME_RETRY_MAXIMUM =                                     600000;
+    constexpr uint16_t TIME_IDLE_MAXIMUM =                                      50;         // Longest idle, to keep the socket responsive.
+    constexpr schedulerSleep_t LOOP_SLEEP =                                     SCHEDULER_SLEEP_MODEM;      // Keeps the CPU on, so the button edges are taken at once.
+
+    // Boot
+    constexpr bool FAST_BOOT =                                                  true;       // Shows the readings while the network is still loading, without the waits of the messages.
+
+    // Batch
+    constexpr bool BATCH_MODE =                                                 false;      // Deep sleep between samples, uploading every few wakes; needs GPIO16 wired to RST.
+
+    // Profiler
+    constexpr uint32_t TIME_PROFILER_REPORT =                                   600000;     // Summary of the stages of the loop printed on the serial port.
+    inline const char PROFILER_STAGE_WIFI[] PROGMEM =                           "wifi";
+    inline const char PROFILER_STAGE_SOCKET[] PROGMEM =                         "socket";
+    inline const char PROFILER_STAGE_BUTTON[] PROGMEM =                         "button";
+    inline const char PROFILER_STAGE_SENSOR[] PROGMEM =                         "sensor";
+    inline const char PROFILER_STAGE_SCREEN[] PROGMEM =                         "screen";
+    inline const char PROFILER_STAGE_STATUS[] PROGMEM =                         "status";
+    inline const char PROFILER_STAGE_EEPROM[] PROGMEM =                         "eeprom";
+    inline const char PROFILER_STAGE_UPDATE_ROOM[] PROGMEM =                    "update_room";
+    inline const char PROFILER_STAGE_UPLOAD[] PROGMEM =                         "upload";
+    inline const char PROFILER_STAGE_NETWORK[] PROGMEM =                        "network";
+
     // Serial Monitor
     constexpr uint32_t BAUDRATE =                                               115200;
 
@@ -14,6 +42,8 @@
     // Button
     constexpr uint8_t BUTTON_PIN =                                              D5;
     constexpr int16_t BUTTON_TIME_LONG_PRESS =                                  3000;
+    constexpr uint16_t BUTTON_TIME_MULTI_CLICK =                                300;
+    constexpr uint16_t BUTTON_TIME_REPEAT =                                     500;
 
     // Screen
     constexpr uint8_t SCREEN_PIN_SCL =                                          20;
@@ -24,4 +54,7 @@
     constexpr uint8_t SENSOR_ADDRESS =                                          0x40;
     constexpr HDC1080_MeasurementResolution SENSOR_HUMIDITY_RESOLUTION =        HDC1080_RESOLUTION_14BIT;
     constexpr HDC1080_MeasurementResolution SENSOR_TEMPERATURE_RESOLUTION =     HDC1080_RESOLUTION_14BIT;
+    constexpr SensorSubscription SENSOR_SUBSCRIPTION_SCREEN =                   {0, SENSOR_CHANNEL_ALL, 0.1, 0.1};          // Values are shown with one decimal.
+    constexpr SensorSubscription SENSOR_SUBSCRIPTION_API_MANAGEMENT =           {60000, SENSOR_CHANNEL_ALL, 0, 0};          // Datetime of the next upload is checked once per minute.
+    constexpr bool SENSOR_RECORD_TRACE =                                        false;                                      // Prints a CSV trace on the serial port, to replay with SensorReplay.
 #endif // SETTINGS_H
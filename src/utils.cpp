@@ -1,16 +1,14 @@
 #include "utils.h"
 
-void showBrand(Button &button, Screen &screen, String &version, uint8_t addressVersionEEPROM, uint16_t timeLogo, uint16_t timeMessageReset) {
+void showBrand(ButtonGesture &buttonGesture, Screen &screen, PGM_P version, uint8_t addressVersionEEPROM, uint16_t timeLogo, uint16_t timeMessageReset) {
     const unsigned long timeoutLogo = millis() + timeLogo;
-    int8_t resultButton = 0;
 
     screen.showBrand(version);
     while (millis() <= timeoutLogo) {
         yield();
 
         /* Checking if there is a request to reset. */
-        resultButton = button.checkPress();
-        if (resultButton == -1) {
+        if (buttonGesture.check() == G_LONG_PRESS) {
             EEPROM.put(addressVersionEEPROM, 0);
             EEPROM.commit();
 
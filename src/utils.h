@@ -1,6 +1,6 @@
 #include <EEPROM.h>
 
-#include <Button.h>
+#include <ButtonGesture.h>
 #include <Screen.h>
 
 /**
@@ -10,13 +10,13 @@
  * During this time, it checks if the user presses the button to trigger a system reset. If the button is pressed,
  * the system will reset the EEPROM values and show a reset completion message on the screen.
  *
- * @param button The Button object used to detect user interaction (button press).
+ * @param buttonGesture The gestures of the button, used to detect the long press that requests the reset.
  * @param screen The Screen object used to display the brand information and messages.
- * @param version The version string of the system, which is displayed as part of the brand information.
+ * @param version The version string of the system, stored in flash, which is displayed as part of the brand information.
  * @param addressVersionEEPROM The address in EEPROM where is located the version, to replace with `0`.
  * @param timeLogo The time in milliseconds for showing the logo.
  * @param timeMessageReset The time in milliseconds for showing the reset message.
  * @warning EEPROM must be already opened before calling this function, otherwise the reset will not work.
  */
 
-void showBrand(Button &button, Screen &screen, String &version, uint8_t addressVersionEEPROM, uint16_t timeLogo, uint16_t timeMessageReset);
\ No newline at end of file
+void showBrand(ButtonGesture &buttonGesture, Screen &screen, PGM_P version, uint8_t addressVersionEEPROM, uint16_t timeLogo, uint16_t timeMessageReset);
\ No newline at end of file
@@ -0,0 +1,371 @@
+/**
+ * @file Arduino.h
+ * @brief Provides the subset of the Arduino core for ESP8266 used by the libraries, to build and run them on the host.
+ *
+ * The time is simulated: `millis()` and `micros()` return a clock that only moves with `delay()`,
+ * `delayMicroseconds()` and `HostClock::advance()`, so the tests decide exactly when the deadlines are reached.
+ * Flash strings are plain strings, and `Serial` writes to the standard output.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.2.0
+ * @date 18th October 2026
+ */
+
+#ifndef ARDUINO_H
+    #define ARDUINO_H
+
+    #include <algorithm>
+    #include <chrono>
+    #include <cmath>
+    #include <cstdarg>
+    #include <cstdint>
+    #include <cstdio>
+    #include <cstdlib>
+    #include <cstring>
+    #include <string>
+
+    #define HIGH                    0x1
+    #define LOW                     0x0
+    #define INPUT                   0x00
+    #define INPUT_PULLUP            0x02
+    #define OUTPUT                  0x01
+    #define RISING                  0x01
+    #define FALLING                 0x02
+    #define CHANGE                  0x03
+    #define DEC                     10
+    #define HEX                     16
+
+    #define D1                      5
+    #define D2                      4
+    #define D5                      14
+
+    #define PROGMEM
+    #define ICACHE_RAM_ATTR
+    #define IRAM_ATTR
+    #define PGM_P                   const char *
+    #define PSTR(s)                 (s)
+    #define pgm_read_byte(address)  (*reinterpret_cast<const uint8_t *>(address))
+    #define pgm_read_word(address)  (*reinterpret_cast<const uint16_t *>(address))
+    #define pgm_read_dword(address) (*reinterpret_cast<const uint32_t *>(address))
+    #define pgm_read_ptr(address)   (*reinterpret_cast<const void *const *>(address))
+    #define strlen_P                strlen
+    #define strcpy_P                strcpy
+    #define strncpy_P               strncpy
+    #define strcmp_P                strcmp
+    #define memcpy_P                memcpy
+
+    class __FlashStringHelper;
+    #define FPSTR(pointer)          (reinterpret_cast<const __FlashStringHelper *>(pointer))
+    #define F(literal)              (reinterpret_cast<const __FlashStringHelper *>(literal))
+
+    typedef bool boolean;
+    typedef uint8_t byte;
+
+    using std::min;
+    using std::max;
+    using std::lround;
+    using std::isnan;
+
+    /**
+     * @brief Simulated clock of the host, in microseconds since the boot.
+     */
+    namespace HostClock {
+        inline uint64_t now = 0;
+
+        inline void advance(uint64_t microseconds) { now += microseconds; }
+
+        inline void reset() { now = 0; }
+    }
+
+    /* As on the ESP8266, the counters have 32 bits and wrap: "millis()" after about 49.7 days, "micros()" after 71 minutes. */
+    inline unsigned long millis() { return static_cast<uint32_t>(HostClock::now / 1000); }
+
+    inline unsigned long micros() { return static_cast<uint32_t>(HostClock::now); }
+
+    inline void delay(unsigned long milliseconds) { HostClock::advance(static_cast<uint64_t>(milliseconds) * 1000); }
+
+    inline void delayMicroseconds(unsigned int microseconds) { HostClock::advance(microseconds); }
+
+    inline void yield() { }
+
+    /**
+     * @brief Simulated pins: the tests write the level read by `digitalRead()`, and `edge()` runs the interrupt.
+     */
+    namespace HostPins {
+        inline uint8_t levels[17] = {};
+        inline void (*interrupts[17])() = {};
+        inline void (*interruptsArg[17])(void *) = {};
+        inline void *arguments[17] = {};
+
+        /** Sets the level of a pin, then runs its interrupt at the actual time as the edge would. */
+        inline void edge(uint8_t pin, uint8_t level) {
+            levels[pin] = level;
+            if (interrupts[pin] != nullptr) {
+                interrupts[pin]();
+            }
+            if (interruptsArg[pin] != nullptr) {
+                interruptsArg[pin](arguments[pin]);
+            }
+        }
+    }
+
+    inline void pinMode(uint8_t pin, uint8_t mode) { HostPins::levels[pin] = (mode == INPUT_PULLUP) ? HIGH : LOW; }
+
+    inline int digitalRead(uint8_t pin) { return HostPins::levels[pin]; }
+
+    inline void digitalWrite(uint8_t pin, uint8_t value) { HostPins::levels[pin] = value; }
+
+    inline int digitalPinToInterrupt(uint8_t pin) { return pin; }
+
+    inline void attachInterrupt(uint8_t pin, void (*handler)(), int mode) { HostPins::interrupts[pin] = handler; }
+
+    inline void attachInterruptArg(uint8_t pin, void (*handler)(void *), void *argument, int mode) {
+        HostPins::interruptsArg[pin] = handler;
+        HostPins::arguments[pin] = argument;
+    }
+
+    inline void detachInterrupt(uint8_t pin) {
+        HostPins::interrupts[pin] = nullptr;
+        HostPins::interruptsArg[pin] = nullptr;
+    }
+
+    inline void noInterrupts() { }
+
+    inline void interrupts() { }
+
+    inline long map(long value, long fromLow, long fromHigh, long toLow, long toHigh) {
+        return (value - fromLow) * (toHigh - toLow) / (fromHigh - fromLow) + toLow;
+    }
+
+    template <typename T>
+    inline T constrain(T value, T low, T high) { return value < low ? low : (value > high ? high : value); }
+
+    inline bool isDigit(int character) { return character >= '0' && character <= '9'; }
+
+    /**
+     * @class String
+     * @brief Arduino string, backed by the standard one.
+     */
+    class String : public std::string {
+        public:
+            String() = default;
+            String(const char *text) : std::string(text != nullptr ? text : "") { }
+            String(const std::string &text) : std::string(text) { }
+            String(const __FlashStringHelper *text) : std::string(reinterpret_cast<const char *>(text)) { }
+            explicit String(char character) : std::string(1, character) { }
+            explicit String(int value, unsigned char base = DEC) : std::string(format(value, base)) { }
+            explicit String(unsigned int value, unsigned char base = DEC) : std::string(format(value, base)) { }
+            explicit String(long value, unsigned char base = DEC) : std::string(format(value, base)) { }
+            explicit String(unsigned long value, unsigned char base = DEC) : std::string(format(value, base)) { }
+            explicit String(unsigned char value, unsigned char base = DEC) : std::string(format(value, base)) { }
+            explicit String(double value, unsigned char decimals = 2) : std::string(formatDecimal(value, decimals)) { }
+            explicit String(float value, unsigned char decimals = 2) : std::string(formatDecimal(value, decimals)) { }
+
+            unsigned int length() const { return static_cast<unsigned int>(size()); }
+            bool isEmpty() const { return empty(); }
+            bool concat(const String &text) { append(text); return true; }
+            bool concat(const char *text) { append(text); return true; }
+            bool concat(char character) { push_back(character); return true; }
+            void toCharArray(char *buffer, unsigned int size) const {
+                if (size == 0) {
+                    return;
+                }
+                strncpy(buffer, c_str(), size - 1);
+                buffer[size - 1] = '\0';
+            }
+            long toInt() const { return strtol(c_str(), nullptr, 10); }
+            float toFloat() const { return strtof(c_str(), nullptr); }
+            int indexOf(char character) const { const size_t position = find(character); return position == npos ? -1 : static_cast<int>(position); }
+            String substring(unsigned int from) const { return String(substr(from)); }
+            String substring(unsigned int from, unsigned int to) const { return String(substr(from, to - from)); }
+            bool startsWith(const String &prefix) const { return compare(0, prefix.size(), prefix) == 0; }
+
+            String &operator+=(const String &text) { append(text); return *this; }
+            String &operator+=(const char *text) { append(text); return *this; }
+            String &operator+=(char character) { push_back(character); return *this; }
+
+        private:
+            template <typename T>
+            static std::string format(T value, unsigned char base) {
+                if (base == HEX) {
+                    char text[24];
+                    snprintf(text, sizeof(text), "%lx", static_cast<unsigned long>(value));
+                    return text;
+                }
+                return std::to_string(value);
+            }
+
+            static std::string formatDecimal(double value, unsigned char decimals) {
+                char text[48];
+                snprintf(text, sizeof(text), "%.*f", decimals, value);
+                return text;
+            }
+    };
+
+    inline String operator+(const String &first, const String &second) { String result(first); result.append(second); return result; }
+    inline String operator+(const String &first, const char *second) { String result(first); result.append(second); return result; }
+    inline String operator+(const char *first, const String &second) { String result(first); result.append(second); return result; }
+    inline String operator+(const String &first, char second) { String result(first); result.push_back(second); return result; }
+    inline String operator+(const String &first, const __FlashStringHelper *second) { return first + reinterpret_cast<const char *>(second); }
+
+    /**
+     * @class Print
+     * @brief Output of characters, as the Arduino one.
+     */
+    class Print {
+        public:
+            virtual ~Print() = default;
+
+            virtual size_t write(uint8_t character) = 0;
+
+            virtual size_t write(const uint8_t *buffer, size_t size) {
+                size_t written = 0;
+                while (size-- > 0) {
+                    written += write(*buffer++);
+                }
+                return written;
+            }
+
+            size_t write(const char *text) { return text == nullptr ? 0 : write(reinterpret_cast<const uint8_t *>(text), strlen(text)); }
+            size_t write(const char *buffer, size_t size) { return write(reinterpret_cast<const uint8_t *>(buffer), size); }
+
+            size_t print(const __FlashStringHelper *text) { return write(reinterpret_cast<const char *>(text)); }
+            size_t print(const String &text) { return write(text.c_str(), text.size()); }
+            size_t print(const char *text) { return write(text); }
+            size_t print(char character) { return write(static_cast<uint8_t>(character)); }
+            size_t print(unsigned char value, int base = DEC) { return print(static_cast<unsigned long>(value), base); }
+            size_t print(int value, int base = DEC) { return print(static_cast<long>(value), base); }
+            size_t print(unsigned int value, int base = DEC) { return print(static_cast<unsigned long>(value), base); }
+            size_t print(long value, int base = DEC) { return printFormatted(base == HEX ? "%lx" : "%ld", value); }
+            size_t print(unsigned long value, int base = DEC) { return printFormatted(base == HEX ? "%lx" : "%lu", value); }
+            size_t print(double value, int decimals = 2) { return printFormatted("%.*f", decimals, value); }
+
+            template <typename T>
+            size_t println(const T &value) { return print(value) + println(); }
+            template <typename T>
+            size_t println(const T &value, int format) { return print(value, format) + println(); }
+            size_t println() { return write("\r\n"); }
+
+            size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+                char text[256];
+                va_list arguments;
+                va_start(arguments, format);
+                const int length = vsnprintf(text, sizeof(text), format, arguments);
+                va_end(arguments);
+                return write(text, std::min(static_cast<size_t>(std::max(length, 0)), sizeof(text) - 1));
+            }
+
+        private:
+            template <typename... Arguments>
+            size_t printFormatted(const char *format, Arguments... arguments) {
+                char text[64];
+                const int length = snprintf(text, sizeof(text), format, arguments...);
+                return write(text, std::min(static_cast<size_t>(std::max(length, 0)), sizeof(text) - 1));
+            }
+    };
+
+    /**
+     * @class Stream
+     * @brief Input of characters with timeout, as the Arduino one; on the host no data arrives late, so there is no wait.
+     */
+    class Stream : public Print {
+        public:
+            virtual int available() = 0;
+            virtual int read() = 0;
+            virtual int peek() = 0;
+
+            void setTimeout(unsigned long timeout) { }
+
+            size_t readBytes(char *buffer, size_t length) {
+                size_t count = 0;
+                while (count < length && available() > 0) {
+                    buffer[count++] = static_cast<char>(read());
+                }
+                return count;
+            }
+
+            size_t readBytes(uint8_t *buffer, size_t length) { return readBytes(reinterpret_cast<char *>(buffer), length); }
+
+            size_t readBytesUntil(char terminator, char *buffer, size_t length) {
+                size_t count = 0;
+                while (count < length && available() > 0) {
+                    const int character = read();
+                    if (character == terminator) {
+                        break;
+                    }
+                    buffer[count++] = static_cast<char>(character);
+                }
+                return count;
+            }
+
+            String readStringUntil(char terminator) {
+                String text;
+                while (available() > 0) {
+                    const int character = read();
+                    if (character == terminator) {
+                        break;
+                    }
+                    text += static_cast<char>(character);
+                }
+                return text;
+            }
+    };
+
+    /**
+     * @class HostStream
+     * @brief Stream over a string in memory, also collecting what is written.
+     */
+    class HostStream : public Stream {
+        public:
+            explicit HostStream(const std::string &input = "") : input(input), position(0) { }
+
+            int available() override { return static_cast<int>(input.size() - position); }
+            int read() override { return position < input.size() ? static_cast<uint8_t>(input[position++]) : -1; }
+            int peek() override { return position < input.size() ? static_cast<uint8_t>(input[position]) : -1; }
+            size_t write(uint8_t character) override { output.push_back(static_cast<char>(character)); return 1; }
+            using Print::write;
+
+            std::string input;                  /**< Data to read. */
+            size_t position;                    /**< Position of the next character to read. */
+            std::string output;                 /**< Data written. */
+    };
+
+    /**
+     * @class HardwareSerial
+     * @brief Serial port, written to the standard output.
+     */
+    class HardwareSerial : public Stream {
+        public:
+            void begin(unsigned long baudrate) { }
+            int available() override { return 0; }
+            int read() override { return -1; }
+            int peek() override { return -1; }
+            size_t write(uint8_t character) override { return fputc(character, stdout) == EOF ? 0 : 1; }
+            using Print::write;
+    };
+
+    inline HardwareSerial Serial;
+
+    /**
+     * @class EspClass
+     * @brief Chip functions; the cycle counter runs at 80 MHz on the real time of the host.
+     */
+    class EspClass {
+        public:
+            uint32_t getCycleCount() {
+                const auto elapsed = std::chrono::steady_clock::now().time_since_epoch();
+                return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() * 80 / 1000);
+            }
+            uint8_t getCpuFreqMHz() { return 80; }
+            uint32_t getFreeHeap() { return 0; }
+            void restart() { }
+    };
+
+    inline EspClass ESP;
+
+#endif // ARDUINO_H
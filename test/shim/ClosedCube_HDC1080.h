@@ -0,0 +1,26 @@
+/**
+ * @file ClosedCube_HDC1080.h
+ * @brief Provides the types of the ClosedCube HDC1080 library used by the Sensor, to build it on the host.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef CLOSEDCUBE_HDC1080_H
+    #define CLOSEDCUBE_HDC1080_H
+
+    #include <Arduino.h>
+
+    typedef enum {
+        HDC1080_RESOLUTION_8BIT,
+        HDC1080_RESOLUTION_11BIT,
+        HDC1080_RESOLUTION_14BIT
+    } HDC1080_MeasurementResolution;
+
+#endif // CLOSEDCUBE_HDC1080_H
@@ -0,0 +1,35 @@
+/**
+ * @file DHT.h
+ * @brief Provides the DHT library of Adafruit on the host, where no sensor is connected.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef DHT_H
+    #define DHT_H
+
+    #include <Arduino.h>
+
+    #define DHT11   11
+    #define DHT22   22
+
+    /**
+     * @class DHT
+     * @brief Sensor without answer: every reading is not a number, as on a failed transfer.
+     */
+    class DHT {
+        public:
+            DHT(uint8_t pin, uint8_t type) { }
+            void begin() { }
+            float readTemperature() { return NAN; }
+            float readHumidity() { return NAN; }
+    };
+
+#endif // DHT_H
@@ -0,0 +1,20 @@
+/**
+ * @file DHT_U.h
+ * @brief Provides the unified DHT library of Adafruit on the host; only the plain one is used.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef DHT_U_H
+    #define DHT_U_H
+
+    #include <DHT.h>
+
+#endif // DHT_U_H
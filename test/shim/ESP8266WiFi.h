@@ -0,0 +1,38 @@
+/**
+ * @file ESP8266WiFi.h
+ * @brief Provides the power management of the Wi-Fi of the ESP8266 core on the host, recording what is set.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef ESP8266WIFI_H
+    #define ESP8266WIFI_H
+
+    #include <Arduino.h>
+
+    typedef enum WiFiSleepType : uint8_t {WIFI_NONE_SLEEP = 0, WIFI_LIGHT_SLEEP = 1, WIFI_MODEM_SLEEP = 2} WiFiSleepType_t;
+
+    /**
+     * @class ESP8266WiFiClass
+     * @brief Station that is never connected.
+     */
+    class ESP8266WiFiClass {
+        public:
+            bool setSleepMode(WiFiSleepType_t type, uint8_t listenInterval = 0) { sleepMode = type; return true; }
+            WiFiSleepType_t getSleepMode() const { return sleepMode; }
+            bool isConnected() const { return false; }
+
+        private:
+            WiFiSleepType_t sleepMode = WIFI_NONE_SLEEP;    /**< Sleep mode set. */
+    };
+
+    inline ESP8266WiFiClass WiFi;
+
+#endif // ESP8266WIFI_H
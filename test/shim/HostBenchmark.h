@@ -0,0 +1,61 @@
+/**
+ * @file HostBenchmark.h
+ * @brief Provides the timing loop shared by the host tests.
+ *
+ * Every benchmark runs the function a few times to warm up, then measures a fixed number of iterations with the
+ * monotonic clock of the host, printing a line "[BENCH] <name>: <nanoseconds>/iteration". The clock of `millis()` is
+ * simulated on the host, so it is never used here. The figures compare two implementations on the same machine;
+ * they are not the timing on the ESP8266.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef HOSTBENCHMARK_H
+    #define HOSTBENCHMARK_H
+
+    #include <chrono>
+    #include <cstdio>
+    #include <cstdint>
+
+    namespace HostBenchmark {
+        /**
+         * @brief Keeps a value alive, so the compiler cannot drop the work that produced it.
+         */
+        template <typename T>
+        inline void keep(const T &value) { asm volatile("" : : "g"(&value) : "memory"); }
+
+        /**
+         * @brief Measures the average time of a function.
+         *
+         * @param name Label printed with the result.
+         * @param iterations Number of measured calls.
+         * @param function Work to measure, called with the index of the iteration.
+         * @return The average time of a call, in nanoseconds.
+         */
+        template <typename F>
+        double run(const char *name, uint32_t iterations, F &&function) {
+            for (uint32_t i = 0; i < iterations / 10 + 1; i++) {
+                function(i);
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < iterations; i++) {
+                function(i);
+            }
+            const auto stop = std::chrono::steady_clock::now();
+
+            const double nanoseconds = std::chrono::duration<double, std::nano>(stop - start).count() / iterations;
+            printf("[BENCH] %s: %.1f ns/iteration (%u iterations)\n", name, nanoseconds, iterations);
+
+            return nanoseconds;
+        }
+    }
+
+#endif // HOSTBENCHMARK_H
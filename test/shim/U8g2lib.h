@@ -0,0 +1,133 @@
+/**
+ * @file U8g2lib.h
+ * @brief Provides the subset of the Arduino class of U8g2 used by the Screen, over the C library of U8g2.
+ *
+ * The C library ("clib" of U8g2, built into the host tests by "test/u8g2_clib.py") is the same of the device, so
+ * fonts, icons, graphics, buffers and transfers of the tiles are those of the firmware. Only the Arduino layer is
+ * replaced: the displays are set up with a bus that drops every byte, and what the controller would receive is
+ * taken through its display callback (`U8X8_MSG_DISPLAY_DRAW_TILE`), as ScreenFramebuffer does.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 2.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef U8G2LIB_H
+    #define U8G2LIB_H
+
+    #include <Arduino.h>
+
+    #include "u8g2.h"
+
+    /**
+     * @class U8G2
+     * @brief Graphics over a `u8g2_t`, with the methods of the Arduino class of U8g2.
+     */
+    class U8G2 : public Print {
+        public:
+            U8G2() : u8g2(), tx(0), ty(0) { }
+
+            u8g2_t *getU8g2() { return &u8g2; }
+            u8x8_t *getU8x8() { return u8g2_GetU8x8(&u8g2); }
+
+            bool begin() {
+                u8g2_InitDisplay(&u8g2);
+                u8g2_ClearDisplay(&u8g2);
+                u8g2_SetPowerSave(&u8g2, 0);
+                return true;
+            }
+
+            void setPowerSave(uint8_t isEnabled) { u8g2_SetPowerSave(&u8g2, isEnabled); }
+            void setContrast(uint8_t value) { u8g2_SetContrast(&u8g2, value); }
+
+            uint8_t *getBufferPtr() { return u8g2_GetBufferPtr(&u8g2); }
+            uint8_t getBufferTileWidth() { return u8g2_GetBufferTileWidth(&u8g2); }
+            uint8_t getBufferTileHeight() { return u8g2_GetBufferTileHeight(&u8g2); }
+            uint8_t getBufferCurrTileRow() { return u8g2_GetBufferCurrTileRow(&u8g2); }
+            void setBufferCurrTileRow(uint8_t row) { u8g2_SetBufferCurrTileRow(&u8g2, row); }
+            u8g2_uint_t getDisplayWidth() { return u8g2_GetDisplayWidth(&u8g2); }
+            u8g2_uint_t getDisplayHeight() { return u8g2_GetDisplayHeight(&u8g2); }
+
+            void clearBuffer() { u8g2_ClearBuffer(&u8g2); }
+            void sendBuffer() { u8g2_SendBuffer(&u8g2); }
+            void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) { u8g2_UpdateDisplayArea(&u8g2, tx, ty, tw, th); }
+            void updateDisplay() { u8g2_UpdateDisplay(&u8g2); }
+            void firstPage() { u8g2_FirstPage(&u8g2); }
+            uint8_t nextPage() { return u8g2_NextPage(&u8g2); }
+            void clearDisplay() { u8g2_ClearDisplay(&u8g2); }
+
+            void clear() {
+                home();
+                clearDisplay();
+                clearBuffer();
+            }
+
+            void home() {
+                tx = 0;
+                ty = 0;
+            }
+
+            void setDrawColor(uint8_t color) { u8g2_SetDrawColor(&u8g2, color); }
+            void drawPixel(u8g2_uint_t x, u8g2_uint_t y) { u8g2_DrawPixel(&u8g2, x, y); }
+            void drawHLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w) { u8g2_DrawHLine(&u8g2, x, y, w); }
+            void drawVLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t h) { u8g2_DrawVLine(&u8g2, x, y, h); }
+            void drawBox(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) { u8g2_DrawBox(&u8g2, x, y, w, h); }
+            void drawFrame(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) { u8g2_DrawFrame(&u8g2, x, y, w, h); }
+            void drawLine(u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t x2, u8g2_uint_t y2) { u8g2_DrawLine(&u8g2, x1, y1, x2, y2); }
+            void drawCircle(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t opt = U8G2_DRAW_ALL) { u8g2_DrawCircle(&u8g2, x0, y0, rad, opt); }
+            void drawDisc(u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t opt = U8G2_DRAW_ALL) { u8g2_DrawDisc(&u8g2, x0, y0, rad, opt); }
+            void drawXBMP(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap) { u8g2_DrawXBMP(&u8g2, x, y, w, h, bitmap); }
+
+            void setFont(const uint8_t *font) { u8g2_SetFont(&u8g2, font); }
+            u8g2_uint_t drawGlyph(u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding) { return u8g2_DrawGlyph(&u8g2, x, y, encoding); }
+            u8g2_uint_t drawStr(u8g2_uint_t x, u8g2_uint_t y, const char *s) { return u8g2_DrawStr(&u8g2, x, y, s); }
+            u8g2_uint_t getStrWidth(const char *s) { return u8g2_GetStrWidth(&u8g2, s); }
+            int8_t getAscent() { return u8g2_GetAscent(&u8g2); }
+            int8_t getDescent() { return u8g2_GetDescent(&u8g2); }
+            int8_t getMaxCharHeight() { return u8g2_GetMaxCharHeight(&u8g2); }
+            int8_t getMaxCharWidth() { return u8g2_GetMaxCharWidth(&u8g2); }
+
+            void setCursor(u8g2_uint_t x, u8g2_uint_t y) {
+                tx = x;
+                ty = y;
+            }
+
+            /* As the Arduino class without `enableUTF8Print()`: every byte is a glyph, the end of line is skipped. */
+            size_t write(uint8_t v) override {
+                const uint16_t encoding = u8x8_ascii_next(u8g2_GetU8x8(&u8g2), v);
+                if (encoding < 0x0FFFE) {
+                    tx += u8g2_DrawGlyph(&u8g2, tx, ty, encoding);
+                }
+                return 1;
+            }
+            using Print::write;
+
+        protected:
+            u8g2_t u8g2;                                /**< State of the display and of the buffer. */
+            u8g2_uint_t tx;                             /**< Position of the next character printed. */
+            u8g2_uint_t ty;                             /**< Baseline of the next character printed. */
+    };
+
+    /**
+     * @brief Displays of the Screen: the SSD1306 of 128x32 pixels on I2C, with a bus that drops every byte.
+     */
+    class U8G2_SSD1306_128X32_UNIVISION_F_HW_I2C : public U8G2 {
+        public:
+            explicit U8G2_SSD1306_128X32_UNIVISION_F_HW_I2C(const u8g2_cb_t *rotation, uint8_t reset = U8X8_PIN_NONE, uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE) {
+                u8g2_Setup_ssd1306_i2c_128x32_univision_f(&u8g2, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+            }
+    };
+
+    class U8G2_SSD1306_128X32_UNIVISION_1_HW_I2C : public U8G2 {
+        public:
+            explicit U8G2_SSD1306_128X32_UNIVISION_1_HW_I2C(const u8g2_cb_t *rotation, uint8_t reset = U8X8_PIN_NONE, uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE) {
+                u8g2_Setup_ssd1306_i2c_128x32_univision_1(&u8g2, rotation, u8x8_byte_empty, u8x8_dummy_cb);
+            }
+    };
+
+#endif // U8G2LIB_H
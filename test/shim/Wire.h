@@ -0,0 +1,41 @@
+/**
+ * @file Wire.h
+ * @brief Provides the I2C bus of the Arduino core on the host, where no device ever answers.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#ifndef WIRE_H
+    #define WIRE_H
+
+    #include <Arduino.h>
+
+    /**
+     * @class TwoWire
+     * @brief I2C bus without devices: every transmission ends with NACK on the address.
+     */
+    class TwoWire : public Stream {
+        public:
+            void begin() { }
+            void begin(int pinSDA, int pinSCL) { }
+            void setClock(uint32_t frequency) { }
+            void beginTransmission(uint8_t address) { }
+            uint8_t endTransmission(bool isStop = true) { return 2; }
+            uint8_t requestFrom(uint8_t address, uint8_t quantity) { return 0; }
+            int available() override { return 0; }
+            int read() override { return -1; }
+            int peek() override { return -1; }
+            size_t write(uint8_t data) override { return 1; }
+            using Print::write;
+    };
+
+    inline TwoWire Wire;
+
+#endif // WIRE_H
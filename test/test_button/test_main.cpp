@@ -0,0 +1,295 @@
+/**
+ * @file test_main.cpp
+ * @brief Tests the analysis of the edges of Button: debounce, presses measured across a stalled loop and recovery
+ *  from a full queue; then the gestures recognized by ButtonGesture on them.
+ *
+ * The edges are made with `HostPins::edge()`, which runs the interrupt of the pin at the time of the fake clock, so
+ * the queue holds the same times and levels of the device; the loop is simulated by calling `checkPress()` only
+ * where the test says, or every 10 ms by `loop()` for the gestures.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <Button.h>
+#include <ButtonGesture.h>
+
+constexpr uint8_t PIN = D5;
+constexpr uint32_t TIME_LONG_PRESS = 3000;
+
+void setUp() {
+    HostClock::reset();
+    HostClock::advance(1000000);
+}
+
+void tearDown() {
+    detachInterrupt(PIN);
+}
+
+void advance(uint32_t milliseconds) { HostClock::advance(static_cast<uint64_t>(milliseconds) * 1000); }
+
+/* The button is on "INPUT_PULLUP", so it is pressed at the low level. */
+void press() { HostPins::edge(PIN, LOW); }
+
+void release() { HostPins::edge(PIN, HIGH); }
+
+/**
+ * @brief Calls `check()` every 10 ms for the given time, as the loop of the firmware.
+ * @return The first gesture recognized, "G_NONE" if there is not any.
+ */
+gesture_t loop(ButtonGesture &gesture, uint32_t milliseconds) {
+    for (uint32_t elapsed = 0; elapsed < milliseconds; elapsed += 10) {
+        advance(10);
+
+        const gesture_t result = gesture.check();
+        if (result != G_NONE) {
+            return result;
+        }
+    }
+
+    return G_NONE;
+}
+
+void click(ButtonGesture &gesture) {
+    press();
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, 100));
+    release();
+}
+
+void test_bounces_are_filtered() {
+    Button button(PIN, B_PULLUP, TIME_LONG_PRESS);
+    button.begin();
+    const uint32_t timePress = millis();
+
+    press();
+    advance(2);
+    release();
+    advance(1);
+    press();
+    advance(20);
+    TEST_ASSERT_EQUAL(0, button.checkPress());
+
+    advance(180);
+    TEST_ASSERT_EQUAL(0, button.checkPress());
+    TEST_ASSERT_TRUE(button.isPressed());
+
+    release();
+    advance(1);
+    press();
+    advance(1);
+    release();
+    advance(DEFAULT_DEBOUNCE - 1);
+    TEST_ASSERT_EQUAL(0, button.checkPress());
+
+    advance(1);
+    TEST_ASSERT_EQUAL(1, button.checkPress());
+    TEST_ASSERT_EQUAL(timePress + 205, button.getTimeLastRelease());
+    TEST_ASSERT_EQUAL(0, button.checkPress());
+    TEST_ASSERT_TRUE(button.isIdle());
+}
+
+void test_glitch_shorter_than_debounce_is_ignored() {
+    Button button(PIN, B_PULLUP, TIME_LONG_PRESS);
+    button.begin();
+
+    press();
+    advance(DEFAULT_DEBOUNCE / 2);
+    release();
+    advance(100);
+
+    TEST_ASSERT_EQUAL(0, button.checkPress());
+    TEST_ASSERT_FALSE(button.isPressed());
+    TEST_ASSERT_TRUE(button.isIdle());
+}
+
+/* The loop is blocked for seconds during the press: the duration comes from the edges, not from the calls. */
+void test_short_press_across_a_stall() {
+    Button button(PIN, B_PULLUP, TIME_LONG_PRESS);
+    button.begin();
+
+    press();
+    advance(1000);
+    release();
+    advance(4000);
+
+    TEST_ASSERT_EQUAL(1, button.checkPress());
+    TEST_ASSERT_EQUAL(0, button.checkPress());
+}
+
+void test_long_press_across_a_stall() {
+    Button button(PIN, B_PULLUP, TIME_LONG_PRESS);
+    button.begin();
+
+    /* Held when the loop comes back: the long press is returned without waiting the release. */
+    press();
+    advance(TIME_LONG_PRESS + 500);
+    TEST_ASSERT_EQUAL(-1, button.checkPress());
+    TEST_ASSERT_EQUAL(0, button.checkPress());
+
+    release();
+    advance(100);
+    TEST_ASSERT_EQUAL(0, button.checkPress());
+
+    /* Released before the loop comes back: the long press is found at the release. */
+    press();
+    advance(TIME_LONG_PRESS + 100);
+    release();
+    advance(2000);
+    TEST_ASSERT_EQUAL(-1, button.checkPress());
+    TEST_ASSERT_EQUAL(0, button.checkPress());
+}
+
+void test_presses_queued_are_returned_one_per_call() {
+    Button button(PIN, B_PULLUP, TIME_LONG_PRESS);
+    button.begin();
+
+    press();
+    advance(100);
+    release();
+    advance(200);
+    press();
+    advance(100);
+    release();
+    advance(600);
+
+    TEST_ASSERT_EQUAL(1, button.checkPress());
+    TEST_ASSERT_FALSE(button.isIdle());
+    TEST_ASSERT_EQUAL(1, button.checkPress());
+    TEST_ASSERT_EQUAL(0, button.checkPress());
+    TEST_ASSERT_TRUE(button.isIdle());
+}
+
+/* More edges than the queue holds: the edges are dropped and the level is taken again from the pin. */
+void test_overflow_recovers_from_the_level() {
+    Button button(PIN, B_PULLUP, TIME_LONG_PRESS);
+    button.begin();
+
+    for (uint8_t i = 0; i <= SIZE_QUEUE_EDGES + 4; i++) {
+        (i % 2 == 0) ? press() : release();
+        advance(1);
+    }
+    TEST_ASSERT_EQUAL(LOW, digitalRead(PIN));
+
+    TEST_ASSERT_EQUAL(0, button.checkPress());
+    TEST_ASSERT_FALSE(button.isPressed());
+
+    advance(DEFAULT_DEBOUNCE);
+    TEST_ASSERT_EQUAL(0, button.checkPress());
+    TEST_ASSERT_TRUE(button.isPressed());
+
+    release();
+    advance(DEFAULT_DEBOUNCE);
+    TEST_ASSERT_EQUAL(1, button.checkPress());
+    TEST_ASSERT_TRUE(button.isIdle());
+
+    /* The queue works again. */
+    press();
+    advance(100);
+    release();
+    advance(DEFAULT_DEBOUNCE);
+    TEST_ASSERT_EQUAL(1, button.checkPress());
+}
+
+/* A single click waits the time of another one, measured from the release. */
+void test_single_click() {
+    Button button(PIN, B_PULLUP, TIME_LONG_PRESS);
+    ButtonGesture gesture(button);
+    button.begin();
+
+    click(gesture);
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, DEFAULT_MULTI_CLICK));
+    TEST_ASSERT_EQUAL(G_CLICK, loop(gesture, 10));
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, 1000));
+}
+
+void test_double_click() {
+    Button button(PIN, B_PULLUP, TIME_LONG_PRESS);
+    ButtonGesture gesture(button);
+    button.begin();
+
+    click(gesture);
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, 150));
+    click(gesture);
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, DEFAULT_MULTI_CLICK));
+    TEST_ASSERT_EQUAL(G_DOUBLE_CLICK, loop(gesture, 10));
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, 1000));
+}
+
+/* No gesture has more clicks, so the third one is returned as soon as its release is debounced. */
+void test_triple_click() {
+    Button button(PIN, B_PULLUP, TIME_LONG_PRESS);
+    ButtonGesture gesture(button);
+    button.begin();
+
+    click(gesture);
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, 100));
+    click(gesture);
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, 100));
+    click(gesture);
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, DEFAULT_DEBOUNCE - 10));
+    TEST_ASSERT_EQUAL(G_TRIPLE_CLICK, loop(gesture, 10));
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, 1000));
+}
+
+/* The long press ends the clicks before it: they are returned first, the long press by the next call. */
+void test_long_press_after_clicks() {
+    Button button(PIN, B_PULLUP, TIME_LONG_PRESS);
+    ButtonGesture gesture(button);
+    button.begin();
+
+    click(gesture);
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, 100));
+
+    press();
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, TIME_LONG_PRESS - 10));
+    TEST_ASSERT_EQUAL(G_CLICK, loop(gesture, 10));
+    TEST_ASSERT_EQUAL(G_LONG_PRESS, gesture.check());
+
+    release();
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, 1000));
+}
+
+void test_hold_repeat() {
+    Button button(PIN, B_PULLUP, TIME_LONG_PRESS);
+    ButtonGesture gesture(button);
+    button.begin();
+
+    press();
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, TIME_LONG_PRESS - 10));
+    TEST_ASSERT_EQUAL(G_LONG_PRESS, loop(gesture, 10));
+
+    /* A repeat every "DEFAULT_REPEAT" from the long press, while held. */
+    for (uint8_t i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL(G_NONE, loop(gesture, DEFAULT_REPEAT - 10));
+        TEST_ASSERT_EQUAL(G_HOLD_REPEAT, loop(gesture, 10));
+    }
+
+    release();
+    TEST_ASSERT_EQUAL(G_NONE, loop(gesture, 2 * DEFAULT_REPEAT));
+    TEST_ASSERT_TRUE(button.isIdle());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_bounces_are_filtered);
+    RUN_TEST(test_glitch_shorter_than_debounce_is_ignored);
+    RUN_TEST(test_short_press_across_a_stall);
+    RUN_TEST(test_long_press_across_a_stall);
+    RUN_TEST(test_presses_queued_are_returned_one_per_call);
+    RUN_TEST(test_overflow_recovers_from_the_level);
+    RUN_TEST(test_single_click);
+    RUN_TEST(test_double_click);
+    RUN_TEST(test_triple_click);
+    RUN_TEST(test_long_press_after_clicks);
+    RUN_TEST(test_hold_repeat);
+    return UNITY_END();
+}
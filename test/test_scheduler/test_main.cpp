@@ -0,0 +1,156 @@
+/**
+ * @file test_main.cpp
+ * @brief Tests the order of the deadlines kept by Scheduler, also across the overflow of `millis()`.
+ *
+ * The fake clock starts 5 seconds before `millis()` wraps, as on a device up for about 49.7 days, so every test has
+ * deadlines on both sides of the overflow. The tasks only record their run.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <Scheduler.h>
+
+constexpr uint32_t TIME_TO_OVERFLOW = 5000;                 // Milliseconds from the start to the last value before the wrap.
+
+uint8_t order[SCHEDULER_MAX_TASKS * 4];
+uint8_t runs = 0;
+
+template <uint8_t ID>
+void task() { order[runs++] = ID; }
+
+void setUp() {
+    HostClock::reset();
+    HostClock::advance(static_cast<uint64_t>(UINT32_MAX - TIME_TO_OVERFLOW) * 1000);
+    runs = 0;
+}
+
+void tearDown() { }
+
+void advance(uint32_t milliseconds) { HostClock::advance(static_cast<uint64_t>(milliseconds) * 1000); }
+
+/* Scheduled in any order, the tasks run in order of deadline, one per step, before and after the wrap. */
+void test_runs_in_order_of_deadline() {
+    Scheduler scheduler;
+    const SchedulerTask functions[8] = {task<0>, task<1>, task<2>, task<3>, task<4>, task<5>, task<6>, task<7>};
+    const uint32_t delays[8] = {7000, 1000, 6000, 3000, 8000, 2000, 5000, 4000};
+    for (uint8_t id = 0; id < 8; id++) {
+        scheduler.schedule(scheduler.add(functions[id]), delays[id]);
+    }
+
+    for (uint8_t step = 0; step < 8; step++) {
+        TEST_ASSERT_EQUAL_UINT32(1000, scheduler.getTimeToNextDeadline());
+        advance(999);
+        TEST_ASSERT_EQUAL(0, scheduler.run());
+        advance(1);
+        TEST_ASSERT_EQUAL(1, scheduler.run());
+    }
+
+    const uint8_t expected[8] = {1, 5, 3, 7, 6, 2, 0, 4};
+    TEST_ASSERT_EQUAL(8, runs);
+    TEST_ASSERT_EQUAL_MEMORY(expected, order, sizeof(expected));
+    TEST_ASSERT_EQUAL_UINT32(SCHEDULER_NO_DEADLINE, scheduler.getTimeToNextDeadline());
+}
+
+void test_cancel_and_reschedule() {
+    Scheduler scheduler;
+    const int8_t first = scheduler.add(task<0>);
+    const int8_t second = scheduler.add(task<1>);
+    const int8_t third = scheduler.add(task<2>);
+    const int8_t fourth = scheduler.add(task<3>);
+    scheduler.schedule(first, 100);
+    scheduler.schedule(second, 200);
+    scheduler.schedule(third, 300);
+    scheduler.schedule(fourth, 400);
+
+    /* Cancelling the nearest and one in the middle; a task not scheduled is left as it is. */
+    scheduler.cancel(first);
+    scheduler.cancel(second);
+    scheduler.cancel(second);
+    TEST_ASSERT_FALSE(scheduler.isScheduled(first));
+    TEST_ASSERT_FALSE(scheduler.isScheduled(second));
+    TEST_ASSERT_EQUAL_UINT32(300, scheduler.getTimeToNextDeadline());
+
+    /* Scheduling again moves the deadline, earlier or later. */
+    scheduler.schedule(fourth, 50);
+    scheduler.schedule(third, TIME_TO_OVERFLOW + 500);
+    TEST_ASSERT_EQUAL_UINT32(50, scheduler.getTimeToNextDeadline());
+
+    advance(TIME_TO_OVERFLOW + 500);
+    TEST_ASSERT_EQUAL(2, scheduler.run());
+
+    scheduler.schedule(second, 10);
+    advance(10);
+    TEST_ASSERT_EQUAL(1, scheduler.run());
+
+    const uint8_t expected[3] = {3, 2, 1};
+    TEST_ASSERT_EQUAL(3, runs);
+    TEST_ASSERT_EQUAL_MEMORY(expected, order, sizeof(expected));
+    TEST_ASSERT_EQUAL_UINT32(SCHEDULER_NO_DEADLINE, scheduler.getTimeToNextDeadline());
+}
+
+/* A periodic task keeps its phase when run a little late, and skips the periods lost in a stall. */
+void test_skips_missed_periods() {
+    Scheduler scheduler;
+    const int8_t id = scheduler.add(task<0>, 1000);
+    scheduler.schedule(id, 1000);
+
+    advance(1200);
+    TEST_ASSERT_EQUAL(1, scheduler.run());
+    TEST_ASSERT_EQUAL_UINT32(800, scheduler.getTimeToNextDeadline());
+
+    /* Stalled across the wrap for more than four periods: a single run, then a whole period from now. */
+    advance(4500);
+    TEST_ASSERT_EQUAL(1, scheduler.run());
+    TEST_ASSERT_EQUAL(0, scheduler.run());
+    TEST_ASSERT_EQUAL_UINT32(1000, scheduler.getTimeToNextDeadline());
+    TEST_ASSERT_TRUE(scheduler.isScheduled(id));
+
+    advance(1000);
+    TEST_ASSERT_EQUAL(1, scheduler.run());
+    TEST_ASSERT_EQUAL(3, runs);
+}
+
+/* A deadline after the wrap has a smaller value than one before it, but comes later. */
+void test_deadlines_across_the_overflow() {
+    Scheduler scheduler;
+    const int8_t after = scheduler.add(task<0>);
+    const int8_t before = scheduler.add(task<1>);
+    scheduler.schedule(after, TIME_TO_OVERFLOW + 1000);
+    scheduler.schedule(before, TIME_TO_OVERFLOW - 1000);
+    TEST_ASSERT_EQUAL_UINT32(TIME_TO_OVERFLOW - 1000, scheduler.getTimeToNextDeadline());
+
+    advance(TIME_TO_OVERFLOW - 1000);
+    TEST_ASSERT_EQUAL(1, scheduler.run());
+    TEST_ASSERT_EQUAL_UINT32(2000, scheduler.getTimeToNextDeadline());
+
+    advance(1999);
+    TEST_ASSERT_TRUE(millis() < TIME_TO_OVERFLOW);
+    TEST_ASSERT_EQUAL(0, scheduler.run());
+    TEST_ASSERT_EQUAL_UINT32(1, scheduler.getTimeToNextDeadline());
+
+    advance(1);
+    TEST_ASSERT_EQUAL(1, scheduler.run());
+
+    const uint8_t expected[2] = {1, 0};
+    TEST_ASSERT_EQUAL(2, runs);
+    TEST_ASSERT_EQUAL_MEMORY(expected, order, sizeof(expected));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_runs_in_order_of_deadline);
+    RUN_TEST(test_cancel_and_reschedule);
+    RUN_TEST(test_skips_missed_periods);
+    RUN_TEST(test_deadlines_across_the_overflow);
+    return UNITY_END();
+}
@@ -0,0 +1,118 @@
+/**
+ * @file test_main.cpp
+ * @brief Simulates an hour of the loop of the firmware on the clock of the host, to check the duty cycle and the
+ *  energy estimated by SchedulerIdle in every sleep mode.
+ *
+ * The tasks advance the clock by the time they would take on the device, and the idle advances it by the time it
+ * waits, so the accounting sees the same timeline of the device. The costs of the tasks are assumptions of the
+ * simulation, not measured on the device: the figures compare the sleep modes, not the real consumption.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <Scheduler.h>
+#include <SchedulerIdle.h>
+
+constexpr uint32_t TIME_SIMULATION = 3600000;               // Milliseconds.
+constexpr uint16_t TIME_IDLE_MAXIMUM = 50;
+constexpr uint32_t COST_LOOP = 20;                          // Microseconds of the socket and the button, every loop.
+constexpr uint32_t COST_SENSOR = 3000;                      // Microseconds of a read of the sensor, every second.
+constexpr uint32_t COST_SCREEN = 150;                       // Microseconds of a frame, every 100 milliseconds.
+constexpr uint32_t COST_STATUS = 50;                        // Microseconds of the status icons, every second.
+
+uint64_t microsWork = 0;
+
+void work(uint32_t microseconds) {
+    HostClock::advance(microseconds);
+    microsWork += microseconds;
+}
+
+void taskSensor() { work(COST_SENSOR); }
+
+void taskScreen() { work(COST_SCREEN); }
+
+void taskStatus() { work(COST_STATUS); }
+
+/**
+ * @brief Runs the loop of the firmware for the time of the simulation.
+ */
+void simulate(SchedulerIdle &schedulerIdle, Scheduler &scheduler, schedulerSleep_t sleep) {
+    HostClock::reset();
+    microsWork = 0;
+
+    scheduler.schedule(scheduler.add(taskSensor, 1000), 0);
+    scheduler.schedule(scheduler.add(taskScreen, 100), 0);
+    scheduler.schedule(scheduler.add(taskStatus, 1000), 0);
+    schedulerIdle.begin(sleep);
+
+    while (millis() < TIME_SIMULATION) {
+        work(COST_LOOP);
+        scheduler.run();
+        schedulerIdle.idle(TIME_IDLE_MAXIMUM);
+    }
+}
+
+void setUp() { }
+
+void tearDown() { }
+
+void test_duty_cycle_matches_the_work() {
+    Scheduler scheduler;
+    SchedulerIdle schedulerIdle(scheduler);
+    simulate(schedulerIdle, scheduler, SCHEDULER_SLEEP_MODEM);
+
+    const uint16_t expected = static_cast<uint16_t>((microsWork * 1000) / HostClock::now);
+    TEST_ASSERT_GREATER_THAN(0, expected);
+    TEST_ASSERT_EQUAL(expected, schedulerIdle.getDutyCycle());
+    TEST_ASSERT_EQUAL(microsWork / 1000, schedulerIdle.getTimeActive());
+    TEST_ASSERT_EQUAL(TIME_SIMULATION / 1000, (schedulerIdle.getTimeActive() + schedulerIdle.getTimeIdle()) / 1000);
+}
+
+void test_sleep_mode_is_set() {
+    Scheduler scheduler;
+    SchedulerIdle schedulerIdle(scheduler);
+
+    schedulerIdle.begin(SCHEDULER_SLEEP_MODEM);
+    TEST_ASSERT_EQUAL(WIFI_MODEM_SLEEP, WiFi.getSleepMode());
+    schedulerIdle.begin(SCHEDULER_SLEEP_LIGHT);
+    TEST_ASSERT_EQUAL(WIFI_LIGHT_SLEEP, WiFi.getSleepMode());
+    schedulerIdle.begin(SCHEDULER_SLEEP_NONE);
+    TEST_ASSERT_EQUAL(WIFI_NONE_SLEEP, WiFi.getSleepMode());
+}
+
+/* Every mode runs the same work, so the energy falls with the current while idle. */
+void simulation_energy_per_mode() {
+    const char *names[3] = {"none", "modem", "light"};
+    uint32_t energies[3];
+
+    for (uint8_t sleep = SCHEDULER_SLEEP_NONE; sleep <= SCHEDULER_SLEEP_LIGHT; sleep++) {
+        Scheduler scheduler;
+        SchedulerIdle schedulerIdle(scheduler);
+        simulate(schedulerIdle, scheduler, static_cast<schedulerSleep_t>(sleep));
+
+        energies[sleep] = schedulerIdle.getEnergyPerHour();
+        printf("[SIM] sleep %s: duty cycle %u/1000, %u mWh per hour\n", names[sleep], schedulerIdle.getDutyCycle(), energies[sleep]);
+    }
+
+    TEST_ASSERT_EQUAL(SCHEDULER_CURRENT_ACTIVE * SCHEDULER_SUPPLY_VOLTAGE / 1000000, energies[SCHEDULER_SLEEP_NONE]);
+    TEST_ASSERT_LESS_THAN(energies[SCHEDULER_SLEEP_NONE], energies[SCHEDULER_SLEEP_MODEM]);
+    TEST_ASSERT_LESS_THAN(energies[SCHEDULER_SLEEP_MODEM], energies[SCHEDULER_SLEEP_LIGHT]);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_duty_cycle_matches_the_work);
+    RUN_TEST(test_sleep_mode_is_set);
+    RUN_TEST(simulation_energy_per_mode);
+    return UNITY_END();
+}
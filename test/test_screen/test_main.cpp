@@ -0,0 +1,327 @@
+/**
+ * @file test_main.cpp
+ * @brief Compares every page of the Screen with its golden image, and measures the time to render each page.
+ *
+ * The images are what the display receives through ScreenFramebuffer, drawn by the C library of U8g2 with the fonts
+ * of the device, stored as PBM in "golden". The same images are checked with the full buffer (env "native") and with
+ * the page buffer (env "native_page_buffer"), so the two modes are proven to show the same pixels. To write the images
+ * again after a change of the layout, run the suite with the environment variable "SCREEN_GOLDEN_UPDATE=1" and review
+ * the new images.
+ * The benchmark prints the mode of the buffer first, so the output of the two environments compares the modes.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.1.0
+ * @date 18th October 2026
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include <HostBenchmark.h>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <Screen.h>
+#include <ScreenFramebuffer.h>
+
+constexpr uint32_t BENCH_ITERATIONS = 20000;
+
+inline const char versionFirmware[] PROGMEM = "5.0.0";
+inline const char versionFirmwareNext[] PROGMEM = "5.0.1";
+
+const char *const messagesRoomID[3] = {installationRoomIDPageMessages0, installationRoomIDPageMessages1, installationRoomIDPageMessages2};
+const char *const messagesWiFi[6] = {
+    installationRoomWiFiPageMessages0, installationRoomWiFiPageMessages1, installationRoomWiFiPageMessages2,
+    installationRoomWiFiPageMessages3, installationRoomWiFiPageMessages4, installationRoomWiFiPageMessages5
+};
+const char *const messagesUpgrade[2] = {upgradeConfigurationToVersionTwoMessages0, upgradeConfigurationToVersionTwoMessages1};
+const char *const messagesFirmwareUpdated[2] = {messagePageFirmwareUpdated0, messagePageFirmwareUpdated1};
+
+/**
+ * @brief A Screen drawing on a ScreenFramebuffer, started as on the device.
+ */
+struct Fixture {
+    ScreenFramebuffer display;
+    Screen screen;
+
+    Fixture() : screen(&display) {
+        screen.begin();
+        screen.setRoomNumber(3);
+        screen.isConnected(true);
+        screen.isUpdated(false);
+    }
+};
+
+std::string pathGolden(const char *name) {
+    const std::string file = __FILE__;
+    return file.substr(0, file.find_last_of("/\\") + 1) + "golden/" + name + ".pbm";
+}
+
+std::string imageOf(const ScreenFramebuffer &display) {
+    HostStream output;
+    display.writePBM(output);
+    return output.output;
+}
+
+/**
+ * @brief Checks the image shown against the golden one; on a difference, the image shown is written next to it.
+ *  A missing golden is written and the test ignored, so a new page is reviewed before it is committed.
+ */
+void assertGolden(const char *name, const ScreenFramebuffer &display) {
+    const std::string path = pathGolden(name);
+    const std::string image = imageOf(display);
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+
+    const char *update = getenv("SCREEN_GOLDEN_UPDATE");
+    if (update != nullptr && strcmp(update, "1") == 0) {
+        std::ofstream(path, std::ios::binary) << image;
+        return;
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::ofstream(path, std::ios::binary) << image;
+        TEST_IGNORE_MESSAGE(("New golden written, review and commit it: " + path).c_str());
+    }
+
+    std::stringstream golden;
+    golden << file.rdbuf();
+    if (golden.str() != image) {
+        std::ofstream(path.substr(0, path.size() - 4) + ".actual.pbm", std::ios::binary) << image;
+        TEST_FAIL_MESSAGE(("The page differs from " + path).c_str());
+    }
+}
+
+/**
+ * @brief Adds the given number of columns to the history, one every "timeHistoryColumn".
+ */
+void fillHistory(Screen &screen, uint8_t columns) {
+    for (uint8_t i = 0; i < columns; i++) {
+        screen.update(20 + (i % 12) * 0.4, 45 - (i % 7) * 1.5);
+        delay(timeHistoryColumn);
+        screen.render();
+    }
+}
+
+void setUp() { HostClock::reset(); }
+
+void tearDown() { }
+
+void test_brand() {
+    Fixture fixture;
+    fixture.screen.showBrand(versionFirmware);
+    assertGolden("brand", fixture.display);
+}
+
+void test_loading_page() {
+    Fixture fixture;
+    fixture.screen.showLoadingPage(loadingPageMessages0, 40);
+    assertGolden("loading", fixture.display);
+}
+
+void test_installation_room_id_page() {
+    Fixture fixture;
+    fixture.screen.showInstallationRoomIDPage(messagesRoomID);
+    assertGolden("installation_room_id", fixture.display);
+}
+
+void test_installation_wifi_pages() {
+    const char *names[3] = {"installation_wifi_error", "installation_wifi_start", "installation_wifi_searching"};
+    for (uint8_t result = 0; result < 3; result++) {
+        Fixture fixture;
+        fixture.screen.showInstallationWiFiPage(messagesWiFi, result);
+        assertGolden(names[result], fixture.display);
+    }
+}
+
+void test_upgrade_version_three_page() {
+    Fixture fixture;
+    fixture.screen.showUpgradeVersionThreePage(messagesUpgrade, String("192.168.1.20"));
+    assertGolden("upgrade_version_three", fixture.display);
+}
+
+void test_message_pages() {
+    Fixture single;
+    single.screen.showMessagePage(messagePageSearchingMessage);
+    assertGolden("message", single.display);
+
+    Fixture two;
+    two.screen.showMessagePage(messagesFirmwareUpdated);
+    assertGolden("message_two_lines", two.display);
+}
+
+void test_custom_page() {
+    Fixture fixture;
+    fixture.screen.showPage([](U8G2 &display) {
+        display.drawFrame(0, 0, 128, 32);
+        display.drawLine(0, 0, 127, 31);
+    });
+    assertGolden("custom", fixture.display);
+}
+
+void test_main_page() {
+    Fixture empty;
+    empty.screen.showMainPage();
+    assertGolden("main_empty", empty.display);
+
+    Fixture fixture;
+    fixture.screen.update(21.5, 40.3);
+    fixture.screen.showMainPage();
+    assertGolden("main", fixture.display);
+}
+
+/* A change sent as partial update has to leave the display as a whole new frame would. */
+void test_main_page_partial_update() {
+    Fixture fixture;
+    fixture.screen.update(21.5, 40.3);
+    fixture.screen.showMainPage();
+    fixture.display.resetTilesSent();
+    fixture.screen.update(-4.2, 40.3);
+    fixture.screen.isConnected(false);
+    fixture.screen.render();
+
+    Fixture whole;
+    whole.screen.update(-4.2, 40.3);
+    whole.screen.isConnected(false);
+    whole.screen.showMainPage();
+
+    TEST_ASSERT_TRUE(imageOf(whole.display) == imageOf(fixture.display));
+    #ifndef SCREEN_PAGE_BUFFER
+        TEST_ASSERT_LESS_THAN(widthDisplayTiles * heightDisplayTiles, fixture.display.getTilesSent());
+    #endif
+}
+
+void test_history_page() {
+    Fixture fixture;
+    fillHistory(fixture.screen, 40);
+    fixture.screen.showHistoryPage();
+    assertGolden("history", fixture.display);
+}
+
+/* The history shifted by a column, as sent after a new column, has to match the history drawn from scratch. */
+void test_history_page_incremental() {
+    Fixture fixture;
+    fillHistory(fixture.screen, 40);
+    fixture.screen.showHistoryPage();
+    fixture.screen.update(20, 45);
+    delay(timeHistoryColumn);
+    fixture.screen.render();
+
+    HostClock::reset();
+    Fixture whole;
+    fillHistory(whole.screen, 40);
+    whole.screen.update(20, 45);
+    delay(timeHistoryColumn);
+    whole.screen.render();
+    whole.screen.showHistoryPage();
+
+    TEST_ASSERT_TRUE(imageOf(whole.display) == imageOf(fixture.display));
+}
+
+/* The bytes accounted by the Screen have to be the bytes that reached the display, in both buffer modes. */
+void test_bytes_sent_match_the_tiles() {
+    Fixture fixture;
+    Screen &screen = fixture.screen;
+    ScreenFramebuffer &display = fixture.display;
+
+    const auto assertBytes = [&]() {
+        TEST_ASSERT_EQUAL(display.getTilesSent() * 8, screen.getBytesLastFrame());
+        display.resetTilesSent();
+    };
+
+    display.resetTilesSent();
+    screen.showBrand(versionFirmware);
+    assertBytes();
+    screen.update(21.5, 40.3);
+    screen.showMainPage();
+    assertBytes();
+    screen.update(21.6, 40.3);
+    screen.render();
+    assertBytes();
+    screen.showMainPage();
+    assertBytes();
+
+    #ifdef SCREEN_PAGE_BUFFER
+        TEST_ASSERT_EQUAL(1, display.getBufferTileHeight());
+    #else
+        TEST_ASSERT_EQUAL(heightDisplayTiles, display.getBufferTileHeight());
+    #endif
+}
+
+/*
+ * Time to compose and send every page. Each iteration changes something on the page, so no frame is skipped for
+ *  being equal to the previous one: the figures are the cost of a frame that reaches the display.
+ */
+void bench_pages() {
+    Fixture fixture;
+    Screen &screen = fixture.screen;
+
+    printf("[BENCH] buffer: %s, %u bytes\n", fixture.display.getBufferTileHeight() == heightDisplayTiles ? "full" : "page", fixture.display.getBufferTileHeight() * widthDisplayTiles * 8);
+    HostBenchmark::run("showBrand", BENCH_ITERATIONS, [&](uint32_t i) { screen.showBrand((i & 1) ? versionFirmware : versionFirmwareNext); });
+    HostBenchmark::run("showLoadingPage", BENCH_ITERATIONS, [&](uint32_t i) { screen.showLoadingPage(loadingPageMessages0, i % 100); });
+    HostBenchmark::run("showInstallationRoomIDPage", BENCH_ITERATIONS, [&](uint32_t i) {
+        screen.setRoomNumber(i % 9 + 1);
+        screen.showInstallationRoomIDPage(messagesRoomID);
+    });
+    HostBenchmark::run("showInstallationWiFiPage", BENCH_ITERATIONS, [&](uint32_t i) { screen.showInstallationWiFiPage(messagesWiFi, i % 3); });
+    HostBenchmark::run("showUpgradeVersionThreePage", BENCH_ITERATIONS, [&](uint32_t i) {
+        screen.showUpgradeVersionThreePage(messagesUpgrade, (i & 1) ? String("192.168.1.20") : String("192.168.1.21"));
+    });
+    HostBenchmark::run("showMessagePage", BENCH_ITERATIONS, [&](uint32_t i) {
+        if (i & 1) {
+            screen.showMessagePage(messagePageSearchingMessage);
+        } else {
+            screen.showMessagePage(messagesFirmwareUpdated);
+        }
+    });
+
+    /* A whole main page needs another page before it: the time of that page is measured alone and subtracted. */
+    const double timeBrand = HostBenchmark::run("showBrand, same version", BENCH_ITERATIONS, [&](uint32_t i) { screen.showBrand(versionFirmware); });
+    const double timeMainAndBrand = HostBenchmark::run("showMainPage and showBrand", BENCH_ITERATIONS, [&](uint32_t i) {
+        screen.update(15 + (i % 100) / 10.0, 40);
+        screen.showMainPage();
+        screen.showBrand(versionFirmware);
+    });
+    printf("[BENCH] showMainPage, whole frame: %.1f ns/iteration\n", timeMainAndBrand - timeBrand);
+
+    HostBenchmark::run("showMainPage, temperature changed", BENCH_ITERATIONS, [&](uint32_t i) {
+        screen.update(15 + (i % 100) / 10.0, 40);
+        screen.showMainPage();
+    });
+
+    Fixture history;
+    fillHistory(history.screen, historyColumns);
+    history.screen.showHistoryPage();
+    const double timeHistory = HostBenchmark::run("showHistoryPage, same history", BENCH_ITERATIONS, [&](uint32_t i) { history.screen.showHistoryPage(); });
+    const double timeMainAndHistory = HostBenchmark::run("showMainPage and showHistoryPage", BENCH_ITERATIONS, [&](uint32_t i) {
+        history.screen.showMainPage();
+        history.screen.showHistoryPage();
+    });
+    printf("[BENCH] showHistoryPage, whole frame: %.1f ns/iteration\n", timeMainAndHistory - timeHistory);
+
+    TEST_ASSERT_GREATER_THAN(0, screen.getFramesFlushed());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_brand);
+    RUN_TEST(test_loading_page);
+    RUN_TEST(test_installation_room_id_page);
+    RUN_TEST(test_installation_wifi_pages);
+    RUN_TEST(test_upgrade_version_three_page);
+    RUN_TEST(test_message_pages);
+    RUN_TEST(test_custom_page);
+    RUN_TEST(test_main_page);
+    RUN_TEST(test_main_page_partial_update);
+    RUN_TEST(test_history_page);
+    RUN_TEST(test_history_page_incremental);
+    RUN_TEST(test_bytes_sent_match_the_tiles);
+    RUN_TEST(bench_pages);
+    return UNITY_END();
+}
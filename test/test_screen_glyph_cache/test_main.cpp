@@ -0,0 +1,133 @@
+/**
+ * @file test_main.cpp
+ * @brief Tests that the glyph cache draws the same pixels of the font, and measures the two ways of drawing.
+ *
+ * With the page buffer the cache is not filled and every character goes through the font, so the comparison still
+ * holds and the two figures are the same path.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.1.0
+ * @date 18th October 2026
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include <HostBenchmark.h>
+
+#include <ScreenFramebuffer.h>
+#include <ScreenGlyphCache.h>
+
+constexpr uint32_t BENCH_ITERATIONS = 200000;
+
+const uint8_t *const fontValues = u8g2_font_smart_patrol_nbp_tf;
+const uint8_t *const fontLarge = u8g2_font_profont22_mf;
+
+/** Positions of the text, including those clipped by every edge of the display. */
+constexpr int16_t positions[][2] = {{0, 12}, {30, 12}, {30, 30}, {68, 12}, {-3, 12}, {122, 30}, {40, 4}, {40, 40}};
+
+void setUp() { }
+
+void tearDown() { }
+
+void assertSameAsFont(const char *text, const uint8_t *fontText = fontValues) {
+    ScreenFramebuffer cached;
+    ScreenFramebuffer font;
+    ScreenGlyphCache glyphCache;
+    glyphCache.begin(cached, fontText);
+    font.setFont(fontText);
+
+    const uint16_t size = cached.getBufferTileWidth() * cached.getBufferTileHeight() * 8;
+    for (const auto &position : positions) {
+        cached.clearBuffer();
+        font.clearBuffer();
+
+        const uint8_t advanceCached = glyphCache.drawString(cached, position[0], position[1], text);
+        const uint8_t advanceFont = font.drawStr(position[0], position[1], text);
+
+        TEST_ASSERT_EQUAL(advanceFont, advanceCached);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(font.getBufferPtr(), cached.getBufferPtr(), size, text);
+    }
+}
+
+void test_every_cached_character() {
+    for (const char *character = glyphCacheCharacters; *character != '\0'; character++) {
+        const char text[2] = {*character, '\0'};
+        assertSameAsFont(text);
+    }
+}
+
+void test_values_and_units() {
+    assertSameAsFont("-12.5");
+    assertSameAsFont("100.0");
+    assertSameAsFont(unitTemperature);
+    assertSameAsFont(unitHumidity);
+}
+
+void test_characters_not_cached() {
+    assertSameAsFont("AbZ!");
+}
+
+/* The glyphs do not fit the cell of the cache, so they are not cached clipped but drawn through the font. */
+void test_font_larger_than_cache() {
+    assertSameAsFont("-12.5", fontLarge);
+    assertSameAsFont(unitTemperature, fontLarge);
+}
+
+void test_tenths_and_unsigned() {
+    ScreenFramebuffer display;
+    ScreenGlyphCache glyphCache;
+    glyphCache.begin(display, fontValues);
+
+    const uint16_t size = display.getBufferTileWidth() * display.getBufferTileHeight() * 8;
+    uint8_t expected[sizeFrame];
+
+    display.clearBuffer();
+    glyphCache.drawString(display, 30, 12, "-4.2");
+    memcpy(expected, display.getBufferPtr(), size);
+    display.clearBuffer();
+    glyphCache.drawTenths(display, 30, 12, -42);
+    TEST_ASSERT_EQUAL_MEMORY(expected, display.getBufferPtr(), size);
+
+    display.clearBuffer();
+    glyphCache.drawString(display, 108, 15, "7");
+    memcpy(expected, display.getBufferPtr(), size);
+    display.clearBuffer();
+    glyphCache.drawUnsigned(display, 108, 15, 7);
+    TEST_ASSERT_EQUAL_MEMORY(expected, display.getBufferPtr(), size);
+}
+
+/* The value of the main page, as drawn at every change of the temperature. */
+void bench_draw_value() {
+    ScreenFramebuffer display;
+    ScreenGlyphCache glyphCache;
+    glyphCache.begin(display, fontValues);
+    display.setFont(fontValues);
+
+    const double timeCache = HostBenchmark::run("value through the glyph cache", BENCH_ITERATIONS, [&](uint32_t i) {
+        glyphCache.drawTenths(display, 30, 12, 150 + i % 100);
+    });
+    const double timeFont = HostBenchmark::run("value through the font", BENCH_ITERATIONS, [&](uint32_t i) {
+        char text[8];
+        snprintf(text, sizeof(text), "%d.%d", (150 + i % 100) / 10, (150 + i % 100) % 10);
+        display.drawStr(30, 12, text);
+    });
+    printf("[BENCH] cache/font: %.2f\n", timeCache / timeFont);
+
+    HostBenchmark::keep(display.getBufferPtr()[0]);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_every_cached_character);
+    RUN_TEST(test_values_and_units);
+    RUN_TEST(test_characters_not_cached);
+    RUN_TEST(test_font_larger_than_cache);
+    RUN_TEST(test_tenths_and_unsigned);
+    RUN_TEST(bench_draw_value);
+    return UNITY_END();
+}
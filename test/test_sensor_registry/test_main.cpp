@@ -0,0 +1,122 @@
+/**
+ * @file test_main.cpp
+ * @brief Tests the registry of the Sensor observers and measures its two ways of dispatching a notification.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.0.0
+ * @date 18th October 2026
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include <HostBenchmark.h>
+
+#include <SensorObserverRegistry.h>
+
+constexpr uint32_t BENCH_ITERATIONS = 2000000;
+
+class CountingObserver : public SensorObserver {
+    public:
+        uint32_t calls = 0;
+        double temperature = 0;
+        double humidity = 0;
+
+        void update(double temperature, double humidity) override {
+            calls++;
+            this->temperature = temperature;
+            this->humidity = humidity;
+        }
+};
+
+void setUp() { }
+
+void tearDown() { }
+
+void test_notifies_in_order_of_registration() {
+    SensorObserverRegistry<2> registry;
+    CountingObserver typed;
+    CountingObserver virtualObserver;
+
+    TEST_ASSERT_TRUE(registry.add(&typed));
+    TEST_ASSERT_TRUE(registry.add(static_cast<SensorObserver *>(&virtualObserver)));
+    TEST_ASSERT_EQUAL(2, registry.notify(21.5, 40.0, 0));
+
+    TEST_ASSERT_EQUAL(1, typed.calls);
+    TEST_ASSERT_EQUAL(1, virtualObserver.calls);
+    TEST_ASSERT_EQUAL_DOUBLE(21.5, typed.temperature);
+    TEST_ASSERT_EQUAL_DOUBLE(40.0, virtualObserver.humidity);
+}
+
+void test_rejects_duplicates_and_overflow() {
+    SensorObserverRegistry<1> registry;
+    CountingObserver first;
+    CountingObserver second;
+
+    TEST_ASSERT_TRUE(registry.add(&first));
+    TEST_ASSERT_FALSE(registry.add(&first));
+    TEST_ASSERT_FALSE(registry.add(&second));
+    TEST_ASSERT_TRUE(registry.remove(&first));
+    TEST_ASSERT_EQUAL(0, registry.size());
+}
+
+void test_wakes_only_on_a_new_step_of_the_resolution() {
+    SensorObserverRegistry<1> registry;
+    CountingObserver observer;
+    registry.add(&observer, {0, SENSOR_CHANNEL_TEMPERATURE, 0.5, 0});
+
+    registry.notify(21.0, 40.0, 0);
+    registry.notify(21.1, 55.0, 1);
+    TEST_ASSERT_EQUAL(1, observer.calls);
+
+    registry.notify(21.6, 55.0, 2);
+    TEST_ASSERT_EQUAL(2, observer.calls);
+}
+
+void test_respects_the_minimum_interval_across_overflow() {
+    SensorObserverRegistry<1> registry;
+    CountingObserver observer;
+    registry.add(&observer, {1000, SENSOR_CHANNEL_ALL, 0, 0});
+
+    registry.notify(21.0, 40.0, 0xFFFFFF00);
+    registry.notify(22.0, 40.0, 0x00000100);
+    TEST_ASSERT_EQUAL(1, observer.calls);
+
+    registry.notify(22.0, 40.0, 0x00000400);
+    TEST_ASSERT_EQUAL(2, observer.calls);
+}
+
+/*
+ * Both paths call through the function pointer of the entry: the typed one then calls "update()" directly, the
+ *  other loads it from the virtual table. The difference is a load, so it is measured with four observers woken on
+ *  every notification, as in the firmware.
+ */
+void bench_dispatch() {
+    CountingObserver observers[4];
+    SensorObserverRegistry<4> typed;
+    SensorObserverRegistry<4> virtualRegistry;
+    for (CountingObserver &observer : observers) {
+        typed.add(&observer);
+        virtualRegistry.add(static_cast<SensorObserver *>(&observer));
+    }
+
+    const double typedTime = HostBenchmark::run("notify, 4 observers, typed", BENCH_ITERATIONS, [&](uint32_t i) { typed.notify(i, i, i); });
+    const double virtualTime = HostBenchmark::run("notify, 4 observers, virtual", BENCH_ITERATIONS, [&](uint32_t i) { virtualRegistry.notify(i, i, i); });
+    printf("[BENCH] typed/virtual: %.2f\n", typedTime / virtualTime);
+
+    TEST_ASSERT_GREATER_THAN(0, observers[0].calls);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_notifies_in_order_of_registration);
+    RUN_TEST(test_rejects_duplicates_and_overflow);
+    RUN_TEST(test_wakes_only_on_a_new_step_of_the_resolution);
+    RUN_TEST(test_respects_the_minimum_interval_across_overflow);
+    RUN_TEST(bench_dispatch);
+    return UNITY_END();
+}
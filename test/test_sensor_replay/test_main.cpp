@@ -0,0 +1,236 @@
+/**
+ * @file test_main.cpp
+ * @brief Tests the replay of the traces, also from logs of the serial monitor, and measures the pipeline.
+ *
+ * Copyright (c) 2025 Davide Palladino.
+ * All rights reserved.
+ *
+ * @author Davide Palladino
+ * @contact davidepalladino@hotmail.com
+ * @website https://davidepalladino.github.io/
+ * @version 1.1.0
+ * @date 18th October 2026
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include <HostBenchmark.h>
+#include <vector>
+
+#include <SensorReplay.h>
+#include <SensorRecorder.h>
+
+constexpr uint32_t BENCH_RECORDS = 100000;
+
+struct Record {
+    uint32_t timestamp;
+    double temperature;
+    double humidity;
+};
+
+class CollectingObserver : public SensorObserver {
+    public:
+        std::vector<Record> records;
+
+        void update(double temperature, double humidity) override { records.push_back({static_cast<uint32_t>(millis()), temperature, humidity}); }
+};
+
+/** Replays a whole trace as fast as possible, returning the records delivered. */
+std::vector<Record> replay(const std::string &trace) {
+    HostStream input(trace);
+    SensorReplay sensorReplay(input, 0);
+    CollectingObserver observer;
+
+    sensorReplay.addObserver(&observer);
+    sensorReplay.begin();
+    sensorReplay.end();
+    while (!sensorReplay.isEnded()) {
+        sensorReplay.check();
+    }
+
+    return observer.records;
+}
+
+void setUp() { HostClock::reset(); }
+
+void tearDown() { }
+
+void test_replays_a_csv_trace() {
+    const std::vector<Record> records = replay("timestamp,temperature,humidity\n1000,21.50,40.00\n2000,-3.25,55.10\n");
+
+    TEST_ASSERT_EQUAL(2, records.size());
+    TEST_ASSERT_EQUAL_DOUBLE(21.5, records[0].temperature);
+    TEST_ASSERT_EQUAL_DOUBLE(-3.25, records[1].temperature);
+    TEST_ASSERT_EQUAL_DOUBLE(55.1, records[1].humidity);
+}
+
+void test_replays_a_log_with_the_time_of_the_monitor() {
+    const std::vector<Record> records = replay(
+        "18:02:11.431 > \033[1;92m[SENSOR: started]\033[0m\r\n"
+        "18:02:12.431 > 1000,21.50,40.00\r\n"
+        "18:02:13.431 > 2000,21.60,40.20\r\n"
+    );
+
+    TEST_ASSERT_EQUAL(2, records.size());
+    TEST_ASSERT_EQUAL_DOUBLE(21.6, records[1].temperature);
+    TEST_ASSERT_EQUAL_DOUBLE(40.2, records[1].humidity);
+}
+
+void test_discards_the_rest_of_an_overlong_line() {
+    const std::string longLog = "[LOG] " + std::string(SENSOR_TRACE_SIZE_LINE, '.') + " 999,1.00,2.00";
+    const std::vector<Record> records = replay(longLog + "\n1000,21.50,40.00\n");
+
+    TEST_ASSERT_EQUAL(1, records.size());
+    TEST_ASSERT_EQUAL_DOUBLE(21.5, records[0].temperature);
+}
+
+void test_keeps_a_line_that_fills_the_buffer() {
+    std::string line = "1000,21.50,40.00";
+    line += std::string(SENSOR_TRACE_SIZE_LINE - 1 - line.size(), ' ');
+    const std::vector<Record> records = replay(line + "\n2000,22.00,41.00\n");
+
+    TEST_ASSERT_EQUAL(2, records.size());
+    TEST_ASSERT_EQUAL_DOUBLE(40.0, records[0].humidity);
+}
+
+void test_replays_at_the_speed_of_the_trace() {
+    HostStream input("0,20.00,40.00\n60000,21.00,40.00\n");
+    SensorReplay sensorReplay(input, 60);
+    CollectingObserver observer;
+
+    sensorReplay.addObserver(&observer);
+    sensorReplay.begin();
+    sensorReplay.check();
+    sensorReplay.check();
+    TEST_ASSERT_EQUAL(1, observer.records.size());
+
+    delay(1000);
+    sensorReplay.check();
+    TEST_ASSERT_EQUAL(2, observer.records.size());
+}
+
+/* As from the serial port: the lines arrive in pieces, and the stream is empty between them. */
+void test_waits_for_the_rest_of_the_line() {
+    HostStream input("1000,21.");
+    SensorReplay sensorReplay(input, 0);
+    CollectingObserver observer;
+
+    sensorReplay.addObserver(&observer);
+    sensorReplay.begin();
+    TEST_ASSERT_FALSE(sensorReplay.check());
+    TEST_ASSERT_FALSE(sensorReplay.check());
+    TEST_ASSERT_FALSE(sensorReplay.isEnded());
+
+    input.input += "50,40.00\n2000,22.00,";
+    TEST_ASSERT_TRUE(sensorReplay.check());
+    TEST_ASSERT_FALSE(sensorReplay.check());
+    TEST_ASSERT_EQUAL_DOUBLE(21.5, observer.records[0].temperature);
+
+    /* The last line, without terminator, is delivered at the end of the input. */
+    input.input += "41.00";
+    TEST_ASSERT_FALSE(sensorReplay.check());
+    sensorReplay.end();
+    TEST_ASSERT_TRUE(sensorReplay.check());
+    TEST_ASSERT_FALSE(sensorReplay.isEnded());
+    TEST_ASSERT_FALSE(sensorReplay.check());
+    TEST_ASSERT_TRUE(sensorReplay.isEnded());
+
+    TEST_ASSERT_EQUAL(2, observer.records.size());
+    TEST_ASSERT_EQUAL_DOUBLE(41.0, observer.records[1].humidity);
+}
+
+void test_waits_for_the_rest_of_the_record() {
+    HostStream recorded;
+    SensorRecorder recorder(recorded, SENSOR_TRACE_BINARY);
+    recorder.begin();
+    recorder.update(21.5, 40.0);
+
+    HostStream input(recorded.output.substr(0, recorded.output.size() - 3));
+    SensorReplay sensorReplay(input, 0);
+    CollectingObserver observer;
+
+    sensorReplay.addObserver(&observer);
+    sensorReplay.begin();
+    TEST_ASSERT_FALSE(sensorReplay.check());
+    TEST_ASSERT_FALSE(sensorReplay.isEnded());
+
+    input.input = recorded.output;
+    TEST_ASSERT_TRUE(sensorReplay.check());
+    TEST_ASSERT_EQUAL_DOUBLE(21.5, observer.records[0].temperature);
+    TEST_ASSERT_EQUAL_DOUBLE(40.0, observer.records[0].humidity);
+
+    sensorReplay.end();
+    TEST_ASSERT_FALSE(sensorReplay.check());
+    TEST_ASSERT_TRUE(sensorReplay.isEnded());
+}
+
+/*
+ * Recording a replay gives back the same trace, in both formats; the time of the trace is measured from the
+ *  replay, so the records of the round trip are compared on the values.
+ */
+void test_recorder_round_trip() {
+    for (const sensorTraceFormat_t format : {SENSOR_TRACE_CSV, SENSOR_TRACE_BINARY}) {
+        HostStream recorded;
+        SensorRecorder recorder(recorded, format);
+        recorder.begin();
+
+        HostStream input("1000,21.50,40.00\n2000,-3.25,55.10\n");
+        SensorReplay sensorReplay(input, 0);
+        sensorReplay.addObserver(&recorder);
+        sensorReplay.begin();
+        sensorReplay.end();
+        while (!sensorReplay.isEnded()) {
+            sensorReplay.check();
+        }
+
+        const std::vector<Record> records = replay(recorded.output);
+        TEST_ASSERT_EQUAL(2, records.size());
+        TEST_ASSERT_EQUAL_DOUBLE(-3.25, records[1].temperature);
+        TEST_ASSERT_EQUAL_DOUBLE(55.1, records[1].humidity);
+    }
+}
+
+/*
+ * Pipeline of a bench session: a log of the monitor replayed into a recorder, in CSV and then in binary. The
+ *  figures are per record; the traces hold more records than measured, for the warm-up.
+ */
+void bench_pipeline() {
+    std::string log;
+    HostStream binary;
+    SensorRecorder binaryRecorder(binary, SENSOR_TRACE_BINARY);
+    binaryRecorder.begin();
+
+    for (uint32_t i = 0; i < 2 * BENCH_RECORDS; i++) {
+        char line[SENSOR_TRACE_SIZE_LINE];
+        snprintf(line, sizeof(line), "18:02:11.431 > %u,%.2f,%.2f\r\n", i * 1000, 20 + (i % 100) / 10.0, 40 + (i % 50) / 10.0);
+        log += line;
+        binaryRecorder.update(20 + (i % 100) / 10.0, 40 + (i % 50) / 10.0);
+    }
+
+    for (const std::string *trace : {&log, &binary.output}) {
+        HostStream input(*trace);
+        HostStream output;
+        SensorRecorder recorder(output, SENSOR_TRACE_BINARY);
+        SensorReplay sensorReplay(input, 0);
+        sensorReplay.addObserver(&recorder);
+        sensorReplay.begin();
+
+        HostBenchmark::run(trace == &log ? "replay of a monitor log, per record" : "replay of a binary trace, per record", BENCH_RECORDS, [&](uint32_t i) { sensorReplay.check(); });
+        TEST_ASSERT_GREATER_THAN(BENCH_RECORDS, recorder.getRecords());
+        TEST_ASSERT_EQUAL(sensorReplay.getRecords(), recorder.getRecords());
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_replays_a_csv_trace);
+    RUN_TEST(test_replays_a_log_with_the_time_of_the_monitor);
+    RUN_TEST(test_discards_the_rest_of_an_overlong_line);
+    RUN_TEST(test_keeps_a_line_that_fills_the_buffer);
+    RUN_TEST(test_replays_at_the_speed_of_the_trace);
+    RUN_TEST(test_waits_for_the_rest_of_the_line);
+    RUN_TEST(test_waits_for_the_rest_of_the_record);
+    RUN_TEST(test_recorder_round_trip);
+    RUN_TEST(bench_pipeline);
+    return UNITY_END();
+}
@@ -0,0 +1,18 @@
+# Builds the C library of U8g2 ("src/clib" of the Arduino library, plain C without Arduino) into the host tests, so
+# the Screen is drawn with the fonts and the graphics of the device; "test/shim/U8g2lib.h" gives it the Arduino class.
+# The library is kept out of "libdeps", so the Library Dependency Finder does not build its Arduino layer.
+
+Import("env")
+
+from os.path import join
+
+from platformio.package.manager.library import LibraryPackageManager
+
+U8G2_SPEC = "olikraus/U8g2@^2.28.8"
+
+manager = LibraryPackageManager(env.subst(join("$PROJECT_WORKSPACE_DIR", "host")))
+package = manager.get_package(U8G2_SPEC) or manager.install(U8G2_SPEC)
+clib = join(package.path, "src", "clib")
+
+env.Append(CPPPATH=[clib])
+env.BuildSources(join("$BUILD_DIR", "U8g2"), clib)